@@ -0,0 +1,101 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	struct BenchmarkCase
+	{
+		std::string_view name;
+		Benchmark::BenchmarkFunction function;
+	};
+
+	std::vector<BenchmarkCase>& GetBenchmarks()
+	{
+		// A function local static avoids depending on the initialization order of
+		// the registrations in the other translation units.
+		static std::vector<BenchmarkCase> benchmarks;
+		return benchmarks;
+	}
+
+	bool quickMode = false;
+	int mismatchCount = 0;
+	std::atomic<uint64_t> valueSink = 0;
+}
+
+Benchmark::Registration::Registration(std::string_view name, BenchmarkFunction function)
+{
+	GetBenchmarks().push_back(BenchmarkCase{ name, function });
+}
+
+bool Benchmark::IsQuickMode()
+{
+	return quickMode;
+}
+
+void Benchmark::ReportMismatch(std::string_view benchmark, std::string_view detail)
+{
+	std::printf(
+		"MISMATCH in %.*s: %.*s\n",
+		static_cast<int>(benchmark.size()),
+		benchmark.data(),
+		static_cast<int>(detail.size()),
+		detail.data());
+	mismatchCount++;
+}
+
+void Benchmark::KeepValue(uint64_t value)
+{
+	valueSink.fetch_add(value, std::memory_order_relaxed);
+}
+
+int main(int argc, char** argv)
+{
+	std::string_view filter;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--quick") == 0)
+		{
+			quickMode = true;
+		}
+		else
+		{
+			filter = argv[i];
+		}
+	}
+
+	for (const BenchmarkCase& benchmark : GetBenchmarks())
+	{
+		if (filter.empty() || benchmark.name.find(filter) != std::string_view::npos)
+		{
+			std::printf("== %.*s\n", static_cast<int>(benchmark.name.size()), benchmark.name.data());
+			benchmark.function();
+		}
+	}
+
+	return mismatchCount == 0 ? 0 : 1;
+}
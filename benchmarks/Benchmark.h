@@ -0,0 +1,73 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+// A minimal benchmark runner for the platform-neutral code.
+//
+// Each benchmark prints its own results, the runner only handles registration,
+// the command line options and the timing helpers.
+// Usage: StyleBenchmarks [--quick] [name filter]
+namespace Benchmark
+{
+	typedef void(*BenchmarkFunction)();
+
+	struct Registration
+	{
+		Registration(std::string_view name, BenchmarkFunction function);
+	};
+
+	// Gets a value indicating whether the benchmarks should use small inputs,
+	// this is used by the test run.
+	bool IsQuickMode();
+
+	// Reports a result that does not match the reference implementation, the
+	// runner exits with an error code when any benchmark reported a mismatch.
+	void ReportMismatch(std::string_view benchmark, std::string_view detail);
+
+	// Prevents the compiler from removing a computation whose result is unused.
+	void KeepValue(uint64_t value);
+
+	// Runs the function the specified number of times and returns the average
+	// number of nanoseconds per call.
+	template<typename Function>
+	double MeasureNanoseconds(uint64_t iterations, Function&& function)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint64_t i = 0; i < iterations; i++)
+		{
+			function();
+		}
+
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+		return elapsed.count() / static_cast<double>(iterations);
+	}
+}
+
+#define BENCHMARK(name) \
+	static void name(); \
+	static const Benchmark::Registration name##Registration(#name, &name); \
+	static void name()
@@ -0,0 +1,128 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "BuildingStyleCollection.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+	BuildingStyleCollection CreateCollection(size_t entryCount, std::mt19937& random)
+	{
+		std::uniform_int_distribution<uint32_t> styleID(0x10000, 0x7FFFFFFF);
+
+		BuildingStyleCollection collection;
+		collection.reserve(entryCount);
+
+		for (uint32_t i = 0; collection.size() < entryCount; i++)
+		{
+			collection.insert(0x1000 + i, styleID(random), cRZBaseString("Style"));
+		}
+
+		return collection;
+	}
+
+	// The linear search that find_style used before the collection was indexed.
+	BuildingStyleCollection::const_iterator FindStyleLinear(const BuildingStyleCollection& collection, uint32_t styleID)
+	{
+		return std::find_if(
+			collection.begin(),
+			collection.end(),
+			[styleID](const BuildingStyleCollectionEntry& entry) { return entry.styleID == styleID; });
+	}
+}
+
+BENCHMARK(BuildingStyleCollection_FindStyle)
+{
+	const bool quick = Benchmark::IsQuickMode();
+
+	const std::vector<size_t> entryCounts = quick
+		? std::vector<size_t>{ 1000 }
+		: std::vector<size_t>{ 100, 1000, 4000 };
+
+	std::printf("%8s %14s %14s\n", "entries", "indexed", "linear");
+
+	for (const size_t entryCount : entryCounts)
+	{
+		std::mt19937 random(2468);
+
+		const BuildingStyleCollection collection = CreateCollection(entryCount, random);
+
+		// Half of the queries are styles in the collection.
+		std::uniform_int_distribution<size_t> entryIndex(0, collection.size() - 1);
+		std::uniform_int_distribution<uint32_t> styleID(0x10000, 0x7FFFFFFF);
+		std::vector<uint32_t> queries;
+
+		for (size_t i = 0; i < 4096; i++)
+		{
+			queries.push_back((i & 1) == 0 ? (collection.begin() + entryIndex(random))->styleID : styleID(random));
+		}
+
+		for (const uint32_t query : queries)
+		{
+			if (collection.find_style(query) != FindStyleLinear(collection, query))
+			{
+				Benchmark::ReportMismatch("BuildingStyleCollection_FindStyle", "find_style result");
+				return;
+			}
+		}
+
+		const uint64_t passes = quick ? 1 : 1000;
+
+		const double indexedNs = Benchmark::MeasureNanoseconds(
+			passes,
+			[&]()
+			{
+				uint64_t count = 0;
+
+				for (const uint32_t query : queries)
+				{
+					count += collection.find_style(query) != collection.end();
+				}
+
+				Benchmark::KeepValue(count);
+			});
+		const double linearNs = Benchmark::MeasureNanoseconds(
+			quick ? 1 : std::max<uint64_t>(1, 10000 / entryCount),
+			[&]()
+			{
+				uint64_t count = 0;
+
+				for (const uint32_t query : queries)
+				{
+					count += FindStyleLinear(collection, query) != collection.end();
+				}
+
+				Benchmark::KeepValue(count);
+			});
+
+		const double queryCount = static_cast<double>(queries.size());
+
+		std::printf(
+			"%8zu %9.1f ns/q %9.1f ns/q\n",
+			collection.size(),
+			indexedNs / queryCount,
+			linearNs / queryCount);
+	}
+}
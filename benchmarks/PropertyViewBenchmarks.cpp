@@ -0,0 +1,122 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "PropertyData.h"
+#include "PropertyIDs.h"
+#include "PropertyView.h"
+#include <array>
+#include <cstdio>
+
+namespace
+{
+	// The style properties of a building exemplar, this mirrors the structure
+	// that BuildingStyleUtil::ReadBuildingStyleProperties returns.
+	template<template<typename> typename PropertyType>
+	struct BuildingProperties
+	{
+		PropertyType<uint32_t> buildingStyles;
+		PropertyType<uint32_t> occupantGroups;
+	};
+
+	template<template<typename> typename PropertyType>
+	BuildingProperties<PropertyType> ReadBuildingProperties(cISCPropertyHolder* pPropertyHolder)
+	{
+		BuildingProperties<PropertyType> properties;
+		properties.buildingStyles.load(pPropertyHolder, kBuildingStylesProperty);
+		properties.occupantGroups.load(pPropertyHolder, kOccupantGroupsProperty);
+
+		return properties;
+	}
+
+	// The hooks read the properties into an existing variable, which is a move
+	// assignment for PropertyData and a copy for PropertyView.
+	template<template<typename> typename PropertyType>
+	uint64_t CheckBuilding(cISCPropertyHolder* pPropertyHolder, uint32_t style)
+	{
+		BuildingProperties<PropertyType> properties;
+		properties = ReadBuildingProperties<PropertyType>(pPropertyHolder);
+
+		return properties.buildingStyles.contains(style) + properties.occupantGroups.size();
+	}
+
+	struct MockBuilding
+	{
+		std::array<uint32_t, 4> styles{ 0x2000, 0x2001, 0x2002, 0x2003 };
+		std::array<uint32_t, 12> occupantGroups{ 0x1000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005, 0x1100, 0x1101, 0x1102, 0x1103, 0x1104, 0x1105 };
+		cIGZVariant stylesVariant;
+		cIGZVariant occupantGroupsVariant;
+		cISCProperty stylesProperty;
+		cISCProperty occupantGroupsProperty;
+		cISCPropertyHolder propertyHolder;
+
+		MockBuilding()
+			: stylesVariant(),
+			  occupantGroupsVariant(),
+			  stylesProperty(kBuildingStylesProperty, &stylesVariant),
+			  occupantGroupsProperty(kOccupantGroupsProperty, &occupantGroupsVariant),
+			  propertyHolder()
+		{
+			stylesVariant.SetUint32Values(styles.data(), static_cast<uint32_t>(styles.size()));
+			occupantGroupsVariant.SetUint32Values(occupantGroups.data(), static_cast<uint32_t>(occupantGroups.size()));
+			propertyHolder.AddProperty(&stylesProperty);
+			propertyHolder.AddProperty(&occupantGroupsProperty);
+		}
+	};
+}
+
+BENCHMARK(PropertyView_VersusPropertyData)
+{
+	MockBuilding building;
+	const uint64_t iterations = Benchmark::IsQuickMode() ? 1000 : 10000000;
+
+	for (const uint32_t style : { 0x2002u, 0x2004u })
+	{
+		if (CheckBuilding<PropertyData>(&building.propertyHolder, style)
+			!= CheckBuilding<PropertyView>(&building.propertyHolder, style))
+		{
+			Benchmark::ReportMismatch("PropertyView_VersusPropertyData", "property values");
+			return;
+		}
+	}
+
+	const double propertyDataNs = Benchmark::MeasureNanoseconds(
+		iterations,
+		[&]()
+		{
+			Benchmark::KeepValue(CheckBuilding<PropertyData>(&building.propertyHolder, 0x2002));
+		});
+	const double propertyViewNs = Benchmark::MeasureNanoseconds(
+		iterations,
+		[&]()
+		{
+			Benchmark::KeepValue(CheckBuilding<PropertyView>(&building.propertyHolder, 0x2002));
+		});
+
+	if (building.stylesVariant.GetReferenceCount() != 0 || building.occupantGroupsVariant.GetReferenceCount() != 0)
+	{
+		Benchmark::ReportMismatch("PropertyView_VersusPropertyData", "PropertyData did not release its variants");
+		return;
+	}
+
+	std::printf("%14s %14s %14s\n", "PropertyData", "PropertyView", "saved/call");
+	std::printf("%11.1f ns %11.1f ns %11.1f ns\n", propertyDataNs, propertyViewNs, propertyDataNs - propertyViewNs);
+}
@@ -0,0 +1,228 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleListSearch.h"
+#include "WallToWallOccupantGroupIDs.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using WallToWallOption = IBuildingSelectWinContext::WallToWallOption;
+
+namespace
+{
+	// The values that a building exemplar provides to the growth style checks.
+	struct MockBuilding
+	{
+		std::vector<uint32_t> styles;
+		std::vector<uint32_t> occupantGroups;
+		bool hasBuildingStylesProperty;
+		bool isIndustrial;
+	};
+
+	constexpr uint32_t StylePoolSize = 2048;
+	constexpr uint32_t FirstCustomStyle = 0x10000;
+
+	std::vector<uint32_t> CreateStylePool()
+	{
+		std::vector<uint32_t> pool;
+		pool.reserve(StylePoolSize);
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			pool.push_back(0x2000 + i);
+		}
+
+		for (uint32_t i = 4; i < StylePoolSize; i++)
+		{
+			pool.push_back(FirstCustomStyle + i);
+		}
+
+		return pool;
+	}
+
+	std::vector<MockBuilding> CreateCatalog(size_t buildingCount, const std::vector<uint32_t>& stylePool, std::mt19937& random)
+	{
+		std::uniform_int_distribution<size_t> styleIndex(0, stylePool.size() - 1);
+		std::uniform_int_distribution<int> styleCount(1, 4);
+		std::uniform_int_distribution<int> percent(0, 99);
+
+		std::vector<MockBuilding> catalog(buildingCount);
+
+		for (MockBuilding& building : catalog)
+		{
+			const int count = styleCount(random);
+
+			for (int i = 0; i < count; i++)
+			{
+				building.styles.push_back(stylePool[styleIndex(random)]);
+			}
+
+			building.isIndustrial = percent(random) < 20;
+			building.hasBuildingStylesProperty = percent(random) < 70;
+
+			// A typical occupant group list has a few zone and purpose values before the styles.
+			building.occupantGroups = { 0x1000, 0x1001, 0x1100 };
+
+			if (building.isIndustrial)
+			{
+				building.occupantGroups.push_back(0x3000 + static_cast<uint32_t>(percent(random) % 3));
+			}
+
+			if (percent(random) < 10)
+			{
+				building.occupantGroups.push_back(WallToWallOccupantGroupIDs[static_cast<size_t>(percent(random)) % WallToWallOccupantGroupIDs.size()]);
+			}
+
+			building.occupantGroups.insert(building.occupantGroups.end(), building.styles.begin(), building.styles.end());
+		}
+
+		return catalog;
+	}
+
+	bool IsBuildingCompatible(const MockBuilding& building, std::span<const uint32_t> activeStyles, WallToWallOption option)
+	{
+		if (!StyleCompatibilityEngine::CheckWallToWallOption(
+			option,
+			StyleCompatibilityEngine::HasWallToWallOccupantGroup(building.occupantGroups)))
+		{
+			return false;
+		}
+
+		if (StyleCompatibilityEngine::IsCompatibleWithAllStyles(building.hasBuildingStylesProperty, building.isIndustrial))
+		{
+			return true;
+		}
+
+		return StyleListSearch::FindFirstCommonValue(activeStyles, building.styles).has_value();
+	}
+
+	// A straightforward implementation that the engine results are compared against.
+	bool IsBuildingCompatibleReference(const MockBuilding& building, std::span<const uint32_t> activeStyles, WallToWallOption option)
+	{
+		const bool isWallToWall = std::any_of(
+			building.occupantGroups.begin(),
+			building.occupantGroups.end(),
+			[](uint32_t group)
+			{
+				return std::find(WallToWallOccupantGroupIDs.begin(), WallToWallOccupantGroupIDs.end(), group) != WallToWallOccupantGroupIDs.end();
+			});
+
+		if ((option == WallToWallOption::Only && !isWallToWall)
+			|| (option == WallToWallOption::Block && isWallToWall))
+		{
+			return false;
+		}
+
+		if (!building.hasBuildingStylesProperty && building.isIndustrial)
+		{
+			return true;
+		}
+
+		for (const uint32_t style : activeStyles)
+		{
+			if (std::find(building.styles.begin(), building.styles.end(), style) != building.styles.end())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+BENCHMARK(StyleCompatibilityEngine_CatalogSweep)
+{
+	const bool quick = Benchmark::IsQuickMode();
+
+	const std::vector<size_t> catalogSizes = quick
+		? std::vector<size_t>{ 1000 }
+		: std::vector<size_t>{ 1000, 10000, 100000 };
+	const std::vector<size_t> activeStyleCounts = quick
+		? std::vector<size_t>{ 1, 16 }
+		: std::vector<size_t>{ 1, 4, 16, 64, 256, 1024 };
+
+	const std::vector<uint32_t> stylePool = CreateStylePool();
+
+	std::printf("%10s %8s %14s %10s\n", "buildings", "active", "ns/building", "matches");
+
+	for (const size_t catalogSize : catalogSizes)
+	{
+		std::mt19937 random(12345);
+
+		const std::vector<MockBuilding> catalog = CreateCatalog(catalogSize, stylePool, random);
+
+		std::vector<uint32_t> shuffledStyles = stylePool;
+		std::shuffle(shuffledStyles.begin(), shuffledStyles.end(), random);
+
+		for (const size_t activeStyleCount : activeStyleCounts)
+		{
+			const std::span<const uint32_t> activeStyles(shuffledStyles.data(), activeStyleCount);
+
+			size_t matchCount = 0;
+
+			for (const MockBuilding& building : catalog)
+			{
+				const bool result = IsBuildingCompatible(building, activeStyles, WallToWallOption::Mixed);
+
+				if (result != IsBuildingCompatibleReference(building, activeStyles, WallToWallOption::Mixed)
+					|| IsBuildingCompatible(building, activeStyles, WallToWallOption::Only)
+						!= IsBuildingCompatibleReference(building, activeStyles, WallToWallOption::Only)
+					|| IsBuildingCompatible(building, activeStyles, WallToWallOption::Block)
+						!= IsBuildingCompatibleReference(building, activeStyles, WallToWallOption::Block))
+				{
+					Benchmark::ReportMismatch("StyleCompatibilityEngine_CatalogSweep", "building compatibility");
+					return;
+				}
+
+				matchCount += result;
+			}
+
+			// Keep each measurement to roughly the same amount of work.
+			const uint64_t passes = quick ? 1 : std::max<uint64_t>(1, 20000000 / (catalogSize * activeStyleCount));
+
+			const double nanoseconds = Benchmark::MeasureNanoseconds(
+				passes,
+				[&]()
+				{
+					uint64_t count = 0;
+
+					for (const MockBuilding& building : catalog)
+					{
+						count += IsBuildingCompatible(building, activeStyles, WallToWallOption::Mixed);
+					}
+
+					Benchmark::KeepValue(count);
+				});
+
+			std::printf(
+				"%10zu %8zu %14.1f %10zu\n",
+				catalogSize,
+				activeStyleCount,
+				nanoseconds / static_cast<double>(catalogSize),
+				matchCount);
+		}
+	}
+}
@@ -0,0 +1,224 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "StyleListSearch.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<uint32_t> CreateSortedUniqueValues(size_t count, std::mt19937& random)
+	{
+		std::uniform_int_distribution<uint32_t> distribution(0x10000, 0x7FFFFFFF);
+
+		std::vector<uint32_t> values;
+		values.reserve(count);
+
+		while (values.size() < count)
+		{
+			values.push_back(distribution(random));
+
+			if (values.size() == count)
+			{
+				std::sort(values.begin(), values.end());
+				values.erase(std::unique(values.begin(), values.end()), values.end());
+			}
+		}
+
+		return values;
+	}
+
+	// Half of the queries are in the list, the others are random values that are
+	// almost always absent.
+	std::vector<uint32_t> CreateQueries(const std::vector<uint32_t>& values, size_t count, std::mt19937& random)
+	{
+		std::uniform_int_distribution<size_t> index(0, values.size() - 1);
+		std::uniform_int_distribution<uint32_t> value(values.front(), values.back());
+
+		std::vector<uint32_t> queries;
+		queries.reserve(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			queries.push_back((i & 1) == 0 ? values[index(random)] : value(random));
+		}
+
+		return queries;
+	}
+}
+
+BENCHMARK(StyleListSearch_ContainsSorted)
+{
+	const bool quick = Benchmark::IsQuickMode();
+	const size_t unavailableStyleCount = quick ? 1000 : 10000;
+	const uint64_t passes = quick ? 1 : 1000;
+
+	std::mt19937 random(4321);
+
+	const std::vector<uint32_t> unavailableStyles = CreateSortedUniqueValues(unavailableStyleCount, random);
+	const std::vector<uint32_t> queries = CreateQueries(unavailableStyles, 4096, random);
+
+	for (const uint32_t query : queries)
+	{
+		if (StyleListSearch::ContainsSorted(unavailableStyles, query)
+			!= std::binary_search(unavailableStyles.begin(), unavailableStyles.end(), query))
+		{
+			Benchmark::ReportMismatch("StyleListSearch_ContainsSorted", "sorted search result");
+			return;
+		}
+	}
+
+	const double branchlessNs = Benchmark::MeasureNanoseconds(
+		passes,
+		[&]()
+		{
+			uint64_t count = 0;
+
+			for (const uint32_t query : queries)
+			{
+				count += StyleListSearch::ContainsSorted(unavailableStyles, query);
+			}
+
+			Benchmark::KeepValue(count);
+		});
+	const double lowerBoundNs = Benchmark::MeasureNanoseconds(
+		passes,
+		[&]()
+		{
+			uint64_t count = 0;
+
+			for (const uint32_t query : queries)
+			{
+				const auto it = std::lower_bound(unavailableStyles.begin(), unavailableStyles.end(), query);
+
+				count += it != unavailableStyles.end() && *it == query;
+			}
+
+			Benchmark::KeepValue(count);
+		});
+	// The linear search that the lookup used before the list was sorted.
+	const double linearNs = Benchmark::MeasureNanoseconds(
+		quick ? 1 : 10,
+		[&]()
+		{
+			uint64_t count = 0;
+
+			for (const uint32_t query : queries)
+			{
+				count += std::find(unavailableStyles.begin(), unavailableStyles.end(), query) != unavailableStyles.end();
+			}
+
+			Benchmark::KeepValue(count);
+		});
+
+	const double queryCount = static_cast<double>(queries.size());
+
+	std::printf("%zu unavailable style ids\n", unavailableStyles.size());
+	std::printf("%14s %14s %14s\n", "branchless", "lower_bound", "std::find");
+	std::printf(
+		"%9.2f ns/q %9.2f ns/q %9.2f ns/q\n",
+		branchlessNs / queryCount,
+		lowerBoundNs / queryCount,
+		linearNs / queryCount);
+}
+
+BENCHMARK(StyleListSearch_Contains)
+{
+	const bool quick = Benchmark::IsQuickMode();
+
+	const std::vector<size_t> listSizes = quick
+		? std::vector<size_t>{ 1, 7, 16 }
+		: std::vector<size_t>{ 1, 2, 4, 8, 12, 16, 32, 64, 128, 256 };
+
+	constexpr std::array<StyleListSearch::InstructionSet, 3> instructionSets =
+	{
+		StyleListSearch::InstructionSet::Scalar,
+		StyleListSearch::InstructionSet::SSE2,
+		StyleListSearch::InstructionSet::AVX2,
+	};
+	constexpr std::array<const char*, 3> instructionSetNames = { "Scalar", "SSE2", "AVX2" };
+
+	std::printf("Selected instruction set: %s\n", StyleListSearch::GetInstructionSetName());
+	std::printf("%6s", "size");
+
+	for (const char* name : instructionSetNames)
+	{
+		std::printf(" %12s", name);
+	}
+
+	std::printf("\n");
+
+	for (const size_t listSize : listSizes)
+	{
+		std::mt19937 random(1357);
+
+		const std::vector<uint32_t> values = CreateSortedUniqueValues(listSize, random);
+		std::vector<uint32_t> shuffledValues = values;
+		std::shuffle(shuffledValues.begin(), shuffledValues.end(), random);
+
+		const std::vector<uint32_t> queries = CreateQueries(values, 1024, random);
+
+		std::printf("%6zu", listSize);
+
+		for (size_t i = 0; i < instructionSets.size(); i++)
+		{
+			const StyleListSearch::InstructionSet instructionSet = instructionSets[i];
+
+			if (!StyleListSearch::IsInstructionSetSupported(instructionSet))
+			{
+				std::printf(" %12s", "n/a");
+				continue;
+			}
+
+			for (const uint32_t query : queries)
+			{
+				if (StyleListSearch::Contains(instructionSet, shuffledValues, query)
+					!= std::binary_search(values.begin(), values.end(), query))
+				{
+					Benchmark::ReportMismatch("StyleListSearch_Contains", instructionSetNames[i]);
+					return;
+				}
+			}
+
+			const double nanoseconds = Benchmark::MeasureNanoseconds(
+				quick ? 1 : 2000,
+				[&]()
+				{
+					uint64_t count = 0;
+
+					for (const uint32_t query : queries)
+					{
+						count += StyleListSearch::Contains(instructionSet, shuffledValues, query);
+					}
+
+					Benchmark::KeepValue(count);
+				});
+
+			std::printf(" %7.2f ns/q", nanoseconds / static_cast<double>(queries.size()));
+		}
+
+		std::printf("\n");
+	}
+}
@@ -0,0 +1,163 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cIGZVariant.h"
+#include "cISCProperty.h"
+#include "cISCPropertyHolder.h"
+#include <cstdint>
+
+cIGZVariant::cIGZVariant() : pData(nullptr), count(0), referenceCount(0)
+{
+}
+
+cIGZVariant::~cIGZVariant()
+{
+}
+
+uint32_t cIGZVariant::AddRef()
+{
+	return ++referenceCount;
+}
+
+uint32_t cIGZVariant::Release()
+{
+	// The benchmark owns the variants, so they are not deleted when the count reaches zero.
+	return --referenceCount;
+}
+
+uint32_t cIGZVariant::GetCount() const
+{
+	return count;
+}
+
+bool* cIGZVariant::RefBool()
+{
+	return static_cast<bool*>(pData);
+}
+
+uint8_t* cIGZVariant::RefUint8()
+{
+	return static_cast<uint8_t*>(pData);
+}
+
+int8_t* cIGZVariant::RefSint8()
+{
+	return static_cast<int8_t*>(pData);
+}
+
+uint16_t* cIGZVariant::RefUint16()
+{
+	return static_cast<uint16_t*>(pData);
+}
+
+int16_t* cIGZVariant::RefSint16()
+{
+	return static_cast<int16_t*>(pData);
+}
+
+uint32_t* cIGZVariant::RefUint32()
+{
+	return static_cast<uint32_t*>(pData);
+}
+
+int32_t* cIGZVariant::RefSint32()
+{
+	return static_cast<int32_t*>(pData);
+}
+
+uint64_t* cIGZVariant::RefUint64()
+{
+	return static_cast<uint64_t*>(pData);
+}
+
+int64_t* cIGZVariant::RefSint64()
+{
+	return static_cast<int64_t*>(pData);
+}
+
+float* cIGZVariant::RefFloat32()
+{
+	return static_cast<float*>(pData);
+}
+
+double* cIGZVariant::RefFloat64()
+{
+	return static_cast<double*>(pData);
+}
+
+void cIGZVariant::SetUint32Values(uint32_t* pValues, uint32_t count)
+{
+	if (count == 1)
+	{
+		pData = reinterpret_cast<void*>(static_cast<uintptr_t>(pValues[0]));
+		this->count = 0;
+	}
+	else
+	{
+		pData = pValues;
+		this->count = count;
+	}
+}
+
+uint32_t cIGZVariant::GetReferenceCount() const
+{
+	return referenceCount;
+}
+
+cISCProperty::cISCProperty(uint32_t id, cIGZVariant* pVariant) : id(id), pVariant(pVariant)
+{
+}
+
+cISCProperty::~cISCProperty()
+{
+}
+
+uint32_t cISCProperty::GetPropertyID() const
+{
+	return id;
+}
+
+cIGZVariant* cISCProperty::GetPropertyValue()
+{
+	return pVariant;
+}
+
+cISCPropertyHolder::~cISCPropertyHolder()
+{
+}
+
+cISCProperty* cISCPropertyHolder::GetProperty(uint32_t id)
+{
+	for (cISCProperty* pProperty : properties)
+	{
+		if (pProperty->GetPropertyID() == id)
+		{
+			return pProperty;
+		}
+	}
+
+	return nullptr;
+}
+
+void cISCPropertyHolder::AddProperty(cISCProperty* pProperty)
+{
+	properties.push_back(pProperty);
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+
+// A minimal stand-in for the gzcom-dll variant interface, it only has the members
+// that PropertyData and PropertyView use.
+// AddRef and Release are virtual and defined in MockGZCom.cpp, so the benchmarks
+// pay for the same indirect calls as the game's implementation.
+class cIGZVariant
+{
+public:
+	cIGZVariant();
+	virtual ~cIGZVariant();
+
+	virtual uint32_t AddRef();
+	virtual uint32_t Release();
+
+	virtual uint32_t GetCount() const;
+
+	virtual bool* RefBool();
+	virtual uint8_t* RefUint8();
+	virtual int8_t* RefSint8();
+	virtual uint16_t* RefUint16();
+	virtual int16_t* RefSint16();
+	virtual uint32_t* RefUint32();
+	virtual int32_t* RefSint32();
+	virtual uint64_t* RefUint64();
+	virtual int64_t* RefSint64();
+	virtual float* RefFloat32();
+	virtual double* RefFloat64();
+
+	// Sets the uint32 values of the variant, the values must outlive it.
+	// A single value is stored in the data pointer, the same as the game.
+	void SetUint32Values(uint32_t* pValues, uint32_t count);
+
+	uint32_t GetReferenceCount() const;
+
+private:
+	void* pData;
+	uint32_t count;
+	uint32_t referenceCount;
+};
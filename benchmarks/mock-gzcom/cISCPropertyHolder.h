@@ -0,0 +1,38 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "cISCProperty.h"
+#include <vector>
+
+// A minimal stand-in for the gzcom-dll property holder interface.
+class cISCPropertyHolder
+{
+public:
+	virtual ~cISCPropertyHolder();
+
+	virtual cISCProperty* GetProperty(uint32_t id);
+
+	void AddProperty(cISCProperty* pProperty);
+
+private:
+	std::vector<cISCProperty*> properties;
+};
@@ -0,0 +1,106 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <utility>
+
+// A minimal stand-in for the gzcom-dll reference counting smart pointer.
+template<typename T>
+class cRZAutoRefCount
+{
+public:
+	cRZAutoRefCount() : pObject(nullptr)
+	{
+	}
+
+	cRZAutoRefCount(T* pObject) : pObject(pObject)
+	{
+		if (pObject)
+		{
+			pObject->AddRef();
+		}
+	}
+
+	cRZAutoRefCount(const cRZAutoRefCount& other) : cRZAutoRefCount(other.pObject)
+	{
+	}
+
+	cRZAutoRefCount(cRZAutoRefCount&& other) noexcept : pObject(std::exchange(other.pObject, nullptr))
+	{
+	}
+
+	~cRZAutoRefCount()
+	{
+		if (pObject)
+		{
+			pObject->Release();
+		}
+	}
+
+	cRZAutoRefCount& operator=(T* pNewObject)
+	{
+		if (pNewObject)
+		{
+			pNewObject->AddRef();
+		}
+
+		if (pObject)
+		{
+			pObject->Release();
+		}
+
+		pObject = pNewObject;
+		return *this;
+	}
+
+	cRZAutoRefCount& operator=(const cRZAutoRefCount& other)
+	{
+		return *this = other.pObject;
+	}
+
+	cRZAutoRefCount& operator=(cRZAutoRefCount&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (pObject)
+			{
+				pObject->Release();
+			}
+
+			pObject = std::exchange(other.pObject, nullptr);
+		}
+
+		return *this;
+	}
+
+	operator T*() const
+	{
+		return pObject;
+	}
+
+	T* operator->() const
+	{
+		return pObject;
+	}
+
+private:
+	T* pObject;
+};
@@ -0,0 +1,74 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "cIGZString.h"
+#include <string>
+
+// A minimal stand-in for the gzcom-dll string class, it owns a copy of its text.
+class cRZBaseString : public cIGZString
+{
+public:
+	cRZBaseString() : text()
+	{
+	}
+
+	cRZBaseString(const char* value) : text(value)
+	{
+	}
+
+	cRZBaseString(const cIGZString& other) : text(other.ToChar(), other.Strlen())
+	{
+	}
+
+	cRZBaseString(const cRZBaseString& other) : text(other.text)
+	{
+	}
+
+	cRZBaseString(cRZBaseString&& other) noexcept : text(std::move(other.text))
+	{
+	}
+
+	cRZBaseString& operator=(const cRZBaseString& other)
+	{
+		text = other.text;
+		return *this;
+	}
+
+	cRZBaseString& operator=(cRZBaseString&& other) noexcept
+	{
+		text = std::move(other.text);
+		return *this;
+	}
+
+	const char* ToChar() const override
+	{
+		return text.c_str();
+	}
+
+	uint32_t Strlen() const override
+	{
+		return static_cast<uint32_t>(text.size());
+	}
+
+private:
+	std::string text;
+};
@@ -52,3 +52,21 @@ building_style = {}
     -- Gets a value indicating if the specified option is active in the building style UI.
     -- Uses the building_style_ui_buttons table above.
     building_style.is_ui_button_checked = function(buildingStyleUIButton) return false end
+    -- Gets a table containing the call count and latency statistics of the growth hooks, keyed by the hook name.
+    -- Each entry is a table with the call_count, total_ticks and max_ticks numbers, and a histogram table
+    -- where entry 1 is the number of calls that took 0 ticks and entry N is the number of calls that
+    -- took between 2^(N-2) and 2^(N-1) - 1 ticks.
+    -- The statistics are only collected when HookStatistics is enabled in SC4MoreBuildingStyles.ini.
+    building_style.get_hook_statistics = function() return {} end
+    -- Gets a table with the building_types and lot_configuration_ids lists for the specified style id
+    -- or wall to wall occupant group, both lists are sorted in ascending order.
+    -- Lots with buildings that use the Building Styles property are listed under the BTE: W2W General
+    -- occupant group (0xB5C00DDE) when they are wall to wall.
+    -- If styleId is not a number, it will return nil.
+    building_style.get_buildings_with_style = function(styleId) return nil end
+    -- Gets the style index that was assigned to the specified style id, the indexes are in the range
+    -- 0 to get_style_index_count() - 1 and do not change for the rest of the game session.
+    -- If styleId does not have a style index, it will return nil.
+    building_style.get_style_index = function(styleId) return nil end
+    -- Gets the number of style indexes, this is 0 until the first city is loaded.
+    building_style.get_style_index_count = function() return 0 end
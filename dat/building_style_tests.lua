@@ -92,3 +92,104 @@ function null45_building_style_test_is_ui_button_checked()
  
   return "No Kick Out checked = " .. tostring(checked)
 end
+
+function null45_building_style_test_get_hook_statistics()
+  local statistics = building_style.get_hook_statistics()
+  local hook_count = 0
+
+  for name, hook in pairs(statistics) do
+    if type(hook.call_count) ~= "number"
+      or type(hook.total_ticks) ~= "number"
+      or type(hook.max_ticks) ~= "number"
+      or type(hook.histogram) ~= "table" then
+      return name .. " does not have the expected fields"
+    end
+
+    local bucket_count = table.getn(hook.histogram)
+
+    if bucket_count ~= 32 then
+      return name .. " has " .. tostring(bucket_count) .. " histogram buckets, expected 32"
+    end
+
+    -- Each call is counted in exactly one bucket.
+    local bucket_total = 0
+
+    for i, count in ipairs(hook.histogram) do
+      bucket_total = bucket_total + count
+    end
+
+    if bucket_total ~= hook.call_count then
+      return name .. " histogram total does not match the call count"
+    end
+
+    hook_count = hook_count + 1
+  end
+
+  return tostring(hook_count) .. " hooks"
+end
+
+function null45_is_sorted_ascending(t)
+  for i = 2, table.getn(t) do
+    if t[i - 1] >= t[i] then
+      return false
+    end
+  end
+
+  return true
+end
+
+function null45_building_style_test_get_buildings_with_style()
+  local chicago_1890_style_id = hex2dec('2000')
+  local general_w2w_occupant_group = hex2dec('B5C00DDE')
+  local counts = {}
+
+  for i, value in ipairs({chicago_1890_style_id, general_w2w_occupant_group}) do
+    local result = building_style.get_buildings_with_style(value)
+
+    if type(result) ~= "table"
+      or type(result.building_types) ~= "table"
+      or type(result.lot_configuration_ids) ~= "table" then
+      return "the result for " .. tostring(value) .. " does not have the expected fields"
+    end
+
+    if not null45_is_sorted_ascending(result.building_types)
+      or not null45_is_sorted_ascending(result.lot_configuration_ids) then
+      return "the result for " .. tostring(value) .. " is not sorted"
+    end
+
+    table.insert(counts, tostring(table.getn(result.building_types)) .. " buildings, "
+      .. tostring(table.getn(result.lot_configuration_ids)) .. " lot configurations")
+  end
+
+  -- A value that is not a number returns nil.
+  if building_style.get_buildings_with_style("Chicago 1890") ~= nil
+    or building_style.get_buildings_with_style({chicago_1890_style_id}) ~= nil
+    or building_style.get_buildings_with_style() ~= nil then
+    return "a non-number argument did not return nil"
+  end
+
+  return "Chicago 1890: " .. counts[1] .. "; W2W: " .. counts[2]
+end
+
+function null45_building_style_test_get_style_index()
+  local count = building_style.get_style_index_count()
+  local seen = {}
+
+  for i, style_id in ipairs(building_style.get_available_style_ids()) do
+    local index = building_style.get_style_index(style_id)
+
+    if index == nil or index < 0 or index >= count or seen[index] ~= nil then
+      return "style " .. tostring(style_id) .. " does not have a unique style index"
+    end
+
+    seen[index] = style_id
+  end
+
+  -- A value that is not a number returns nil.
+  if building_style.get_style_index("Chicago 1890") ~= nil
+    or building_style.get_style_index() ~= nil then
+    return "a non-number argument did not return nil"
+  end
+
+  return tostring(count) .. " style indexes"
+end
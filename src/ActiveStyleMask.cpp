@@ -0,0 +1,163 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ActiveStyleMask.h"
+#include "BuildingStyleCatalog.h"
+#include "StyleListSearch.h"
+#include <algorithm>
+
+ActiveStyleMask::ActiveStyleMask()
+	: pCatalog(nullptr),
+	  mask(),
+	  unindexedStyles(),
+	  allStylesActive(false)
+{
+}
+
+void ActiveStyleMask::Update(const BuildingStyleCatalog& catalog, std::span<const uint32_t> activeStyles)
+{
+	pCatalog = &catalog;
+	mask.reset(catalog.GetStyleIndexCount());
+	unindexedStyles.clear();
+
+	for (const uint32_t& style : activeStyles)
+	{
+		const std::optional<uint32_t> index = catalog.GetStyleIndex(style);
+
+		if (index.has_value())
+		{
+			mask.set(index.value());
+		}
+		else
+		{
+			// The style was set by a Lua script or the city was saved with a style
+			// that isn't installed, we check these styles the slow way.
+			unindexedStyles.push_back(style);
+		}
+	}
+
+	UpdateAllStylesActive();
+}
+
+void ActiveStyleMask::AddStyle(uint32_t style)
+{
+	const std::optional<uint32_t> index = GetStyleIndex(style);
+
+	if (index.has_value())
+	{
+		mask.set(index.value());
+	}
+	else
+	{
+		unindexedStyles.push_back(style);
+	}
+
+	UpdateAllStylesActive();
+}
+
+void ActiveStyleMask::RemoveStyle(uint32_t style)
+{
+	const std::optional<uint32_t> index = GetStyleIndex(style);
+
+	if (index.has_value())
+	{
+		mask.clear(index.value());
+	}
+	else
+	{
+		const auto it = std::find(unindexedStyles.begin(), unindexedStyles.end(), style);
+
+		if (it != unindexedStyles.end())
+		{
+			unindexedStyles.erase(it);
+		}
+	}
+
+	UpdateAllStylesActive();
+}
+
+bool ActiveStyleMask::FindFirstMatch(
+	std::span<const StyleMask::word_type> styleMask,
+	std::span<const uint32_t> styles,
+	uint32_t& matchingStyle) const
+{
+	const std::optional<uint32_t> index = StyleMask::FindFirstCommonBit(mask.words(), styleMask);
+
+	if (index.has_value())
+	{
+		matchingStyle = pCatalog->GetStyleFromIndex(index.value());
+		return true;
+	}
+
+	return FindFirstUnindexedMatch(styles, matchingStyle);
+}
+
+bool ActiveStyleMask::FindFirstMatch(std::span<const uint32_t> styles, uint32_t& matchingStyle) const
+{
+	if (pCatalog)
+	{
+		for (const uint32_t& style : styles)
+		{
+			const std::optional<uint32_t> index = pCatalog->GetStyleIndex(style);
+
+			if (index.has_value() && mask.test(index.value()))
+			{
+				matchingStyle = style;
+				return true;
+			}
+		}
+	}
+
+	return FindFirstUnindexedMatch(styles, matchingStyle);
+}
+
+bool ActiveStyleMask::AreAllStylesActive() const
+{
+	return allStylesActive;
+}
+
+std::optional<uint32_t> ActiveStyleMask::GetStyleIndex(uint32_t style) const
+{
+	return pCatalog ? pCatalog->GetStyleIndex(style) : std::nullopt;
+}
+
+void ActiveStyleMask::UpdateAllStylesActive()
+{
+	const size_t indexedStyleCount = mask.count();
+
+	allStylesActive = pCatalog
+		&& indexedStyleCount > 0
+		&& indexedStyleCount == pCatalog->GetStyleIndexCount()
+		&& unindexedStyles.empty();
+}
+
+bool ActiveStyleMask::FindFirstUnindexedMatch(std::span<const uint32_t> styles, uint32_t& matchingStyle) const
+{
+	const std::optional<uint32_t> style = StyleListSearch::FindFirstCommonValue(unindexedStyles, styles);
+
+	if (style.has_value())
+	{
+		matchingStyle = style.value();
+		return true;
+	}
+
+	return false;
+}
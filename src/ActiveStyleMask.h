@@ -0,0 +1,68 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "StyleMask.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+class BuildingStyleCatalog;
+
+// A StyleMask that mirrors the tract developer's active style list.
+// Active styles that do not have a catalog style index are kept in a separate list.
+class ActiveStyleMask
+{
+public:
+	ActiveStyleMask();
+
+	void Update(const BuildingStyleCatalog& catalog, std::span<const uint32_t> activeStyles);
+
+	// Updates the mask for a single style that was added to or removed from the
+	// active style list after the last Update call.
+	void AddStyle(uint32_t style);
+	void RemoveStyle(uint32_t style);
+
+	// Finds the first active style in a catalog record.
+	bool FindFirstMatch(
+		std::span<const StyleMask::word_type> styleMask,
+		std::span<const uint32_t> styles,
+		uint32_t& matchingStyle) const;
+
+	// Finds the first active style in a list of styles that does not have a catalog mask,
+	// e.g. the occupant groups of a lot configuration.
+	bool FindFirstMatch(std::span<const uint32_t> styles, uint32_t& matchingStyle) const;
+
+	// Returns true if every style that has a catalog index is active, and there
+	// are no active styles without an index.
+	bool AreAllStylesActive() const;
+
+private:
+	std::optional<uint32_t> GetStyleIndex(uint32_t style) const;
+	void UpdateAllStylesActive();
+	bool FindFirstUnindexedMatch(std::span<const uint32_t> styles, uint32_t& matchingStyle) const;
+
+	const BuildingStyleCatalog* pCatalog;
+	StyleMask mask;
+	std::vector<uint32_t> unindexedStyles;
+	bool allStylesActive;
+};
@@ -30,8 +30,7 @@
 #include "cRZAutoRefCount.h"
 #include "GZServPtrs.h"
 #include "GZWinUtil.h"
-#include "MaxisBuildingStyleUIControlIDs.h"
-#include "ReservedStyleIDs.h"
+#include "OccupantGroupClassifier.h"
 #include "StringResourceKey.h"
 #include "StringResourceManager.h"
 #include <algorithm>
@@ -51,9 +50,11 @@ namespace
 		// The Maxis UI control ids, optional UI control ids, and PIM-X placeholder id are excluded,
 		// every other button in the dialog is a style radio button.
 
-		if (MaxisUIControlIDs.count(childID) == 0
-			&& OptionalButtonIDs.count(childID) == 0
-			&& childID != PIMXPlaceholderStyleID)
+		constexpr uint8_t ExcludedFlags = OccupantGroupClassifier::MaxisUIControl
+			| OccupantGroupClassifier::OptionalButton
+			| OccupantGroupClassifier::PIMXPlaceholder;
+
+		if ((OccupantGroupClassifier::Classify(childID) & ExcludedFlags) == 0)
 		{
 			BuildingStyleWinEnumContext* state = static_cast<BuildingStyleWinEnumContext*>(pState);
 
@@ -282,10 +283,12 @@ void AvailableBuildingStyles::Initialize()
 		EnumerateBuildingStyleCheckBoxes(InitializeBuildingStylesCallback, &context);
 
 		// Sort the items in ascending order.
-		std::sort(
-			context.availableBuildingStyles.begin(),
-			context.availableBuildingStyles.end());
+		context.availableBuildingStyles.sort();
 		std::swap(availableBuildingStyles, context.availableBuildingStyles);
+
+		// The style ids do not change after the first city is loaded, only the names
+		// of the automatic check boxes are updated.
+		buildingStyleIndex.Initialize(availableBuildingStyles);
 	}
 }
 
@@ -298,3 +301,8 @@ const BuildingStyleCollection& AvailableBuildingStyles::GetBuildingStyles() cons
 {
 	return availableBuildingStyles;
 }
+
+const BuildingStyleIndex& AvailableBuildingStyles::GetBuildingStyleIndex() const
+{
+	return buildingStyleIndex;
+}
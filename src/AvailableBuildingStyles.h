@@ -21,6 +21,7 @@
 
 #pragma once
 #include "BuildingStyleCollection.h"
+#include "BuildingStyleIndex.h"
 #include "DefinedBuildingStyles.h"
 
 class cIGZWin;
@@ -36,9 +37,11 @@ public:
 	bool IsStyleButtonIDValid(uint32_t buttonID) const;
 
 	const BuildingStyleCollection& GetBuildingStyles() const;
+	const BuildingStyleIndex& GetBuildingStyleIndex() const;
 
 private:
 	BuildingStyleCollection availableBuildingStyles;
+	BuildingStyleIndex buildingStyleIndex;
 	DefinedBuildingStyles definedBuildingStyles;
 	bool firstCityLoaded;
 };
@@ -0,0 +1,65 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BuildingCompatibilityTable.h"
+#include "BuildingStyleCatalog.h"
+#include <algorithm>
+
+static_assert(BuildingCompatibilityTable::RecordsPerChunk % 32 == 0);
+
+BuildingCompatibilityTable::BuildingCompatibilityTable(uint32_t epoch, uint32_t recordCount)
+	: bits((recordCount + (BitsPerWord - 1)) / BitsPerWord),
+	  epoch(epoch),
+	  recordCount(recordCount)
+{
+}
+
+uint32_t BuildingCompatibilityTable::GetEpoch() const
+{
+	return epoch;
+}
+
+uint32_t BuildingCompatibilityTable::GetRecordCount() const
+{
+	return recordCount;
+}
+
+uint32_t BuildingCompatibilityTable::GetChunkCount() const
+{
+	return (recordCount + (RecordsPerChunk - 1)) / RecordsPerChunk;
+}
+
+bool BuildingCompatibilityTable::IsCompatible(const BuildingStyleRecord& record) const
+{
+	const uint32_t index = record.index;
+
+	return index < recordCount && (bits[index / BitsPerWord] & (1U << (index % BitsPerWord))) != 0;
+}
+
+std::span<uint32_t> BuildingCompatibilityTable::GetChunkWords(uint32_t chunk)
+{
+	constexpr uint32_t WordsPerChunk = RecordsPerChunk / BitsPerWord;
+
+	const size_t firstWord = static_cast<size_t>(chunk) * WordsPerChunk;
+	const size_t wordCount = std::min<size_t>(WordsPerChunk, bits.size() - firstWord);
+
+	return std::span<uint32_t>(bits.data() + firstWord, wordCount);
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct BuildingStyleRecord;
+
+// A precomputed list of the catalog buildings that have at least one of the
+// styles in use, indexed by the catalog record index.
+// The table is built for a single style selection epoch by the
+// BuildingCompatibilityTableBuilder.
+class BuildingCompatibilityTable
+{
+public:
+	// The number of records that are processed by each chunk of a rebuild,
+	// this is a multiple of the word size so the chunks never share a word.
+	static constexpr uint32_t RecordsPerChunk = 1024;
+
+	BuildingCompatibilityTable(uint32_t epoch, uint32_t recordCount);
+
+	uint32_t GetEpoch() const;
+	uint32_t GetRecordCount() const;
+	uint32_t GetChunkCount() const;
+
+	bool IsCompatible(const BuildingStyleRecord& record) const;
+
+	// Gets the words that store the results for the specified chunk.
+	std::span<uint32_t> GetChunkWords(uint32_t chunk);
+
+private:
+	static constexpr uint32_t BitsPerWord = 32;
+
+	std::vector<uint32_t> bits;
+	uint32_t epoch;
+	uint32_t recordCount;
+};
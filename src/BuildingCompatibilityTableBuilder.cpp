@@ -0,0 +1,256 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BuildingCompatibilityTableBuilder.h"
+#include "BuildingStyleCatalog.h"
+#include "StyleListSearch.h"
+#include "StyleMask.h"
+#include <algorithm>
+
+struct BuildingCompatibilityTableBuilder::Job
+{
+	std::shared_ptr<const StyleContextSnapshot> snapshot;
+	const BuildingStyleCatalog* pCatalog = nullptr;
+	StyleMask activeStyleMask;
+	// The styles in use that do not have a catalog style index.
+	std::vector<uint32_t> unindexedStyles;
+	std::shared_ptr<BuildingCompatibilityTable> table;
+	std::atomic<uint32_t> nextChunk = 0;
+	std::atomic<uint32_t> completedChunks = 0;
+	std::atomic<bool> canceled = false;
+};
+
+BuildingCompatibilityTableBuilder::BuildingCompatibilityTableBuilder()
+	: workers(),
+	  mutex(),
+	  jobAvailable(),
+	  currentJob(),
+	  readyTable(),
+	  readyEpoch(0),
+	  hasReadyTable(false),
+	  gameThreadTable()
+{
+}
+
+BuildingCompatibilityTableBuilder::~BuildingCompatibilityTableBuilder()
+{
+	Shutdown();
+}
+
+void BuildingCompatibilityTableBuilder::Rebuild(
+	std::shared_ptr<const StyleContextSnapshot> snapshot,
+	const BuildingStyleCatalog& catalog)
+{
+	std::shared_ptr<Job> job = std::make_shared<Job>();
+	job->pCatalog = &catalog;
+	job->activeStyleMask.reset(catalog.GetStyleIndexCount());
+
+	for (const uint32_t& style : snapshot->GetStylesInUse())
+	{
+		const std::optional<uint32_t> index = catalog.GetStyleIndex(style);
+
+		if (index.has_value())
+		{
+			job->activeStyleMask.set(index.value());
+		}
+		else
+		{
+			job->unindexedStyles.push_back(style);
+		}
+	}
+
+	job->table = std::make_shared<BuildingCompatibilityTable>(snapshot->epoch, static_cast<uint32_t>(catalog.size()));
+	job->snapshot = std::move(snapshot);
+
+	if (workers.empty())
+	{
+		StartWorkers();
+	}
+
+	{
+		std::scoped_lock lock(mutex);
+
+		if (currentJob)
+		{
+			currentJob->canceled = true;
+		}
+
+		currentJob = std::move(job);
+	}
+
+	jobAvailable.notify_all();
+}
+
+const BuildingCompatibilityTable* BuildingCompatibilityTableBuilder::GetTable(uint32_t epoch)
+{
+	if (!gameThreadTable || gameThreadTable->GetEpoch() != epoch)
+	{
+		gameThreadTable.reset();
+
+		// The epoch is checked first so that the table pointer is only
+		// loaded once after each rebuild.
+		if (readyEpoch.load(std::memory_order_acquire) == epoch)
+		{
+			std::shared_ptr<const BuildingCompatibilityTable> table = readyTable.load(std::memory_order_acquire);
+
+			if (table && table->GetEpoch() == epoch)
+			{
+				gameThreadTable = std::move(table);
+			}
+		}
+	}
+
+	return gameThreadTable.get();
+}
+
+BuildingCompatibilityTableBuilder::Status BuildingCompatibilityTableBuilder::GetStatus() const
+{
+	Status status{};
+
+	std::scoped_lock lock(mutex);
+
+	status.workerCount = static_cast<uint32_t>(workers.size());
+
+	if (currentJob)
+	{
+		status.epoch = currentJob->table->GetEpoch();
+		status.completedChunks = currentJob->completedChunks.load();
+		status.chunkCount = currentJob->table->GetChunkCount();
+		status.ready = hasReadyTable && readyEpoch.load() == status.epoch;
+	}
+
+	return status;
+}
+
+void BuildingCompatibilityTableBuilder::Shutdown()
+{
+	{
+		std::scoped_lock lock(mutex);
+
+		if (currentJob)
+		{
+			currentJob->canceled = true;
+		}
+	}
+
+	for (std::jthread& worker : workers)
+	{
+		worker.request_stop();
+	}
+
+	jobAvailable.notify_all();
+	workers.clear();
+}
+
+void BuildingCompatibilityTableBuilder::StartWorkers()
+{
+	// One core is left for the game thread.
+	const uint32_t hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 2U);
+	const uint32_t workerCount = std::min(hardwareThreadCount - 1, 4U);
+
+	workers.reserve(workerCount);
+
+	for (uint32_t i = 0; i < workerCount; i++)
+	{
+		workers.emplace_back([this](std::stop_token stopToken) { WorkerThread(stopToken); });
+	}
+}
+
+void BuildingCompatibilityTableBuilder::WorkerThread(std::stop_token stopToken)
+{
+	std::shared_ptr<Job> lastJob;
+
+	while (!stopToken.stop_requested())
+	{
+		std::shared_ptr<Job> job;
+
+		{
+			std::unique_lock lock(mutex);
+
+			if (!jobAvailable.wait(lock, stopToken, [&] { return currentJob && currentJob != lastJob; }))
+			{
+				break;
+			}
+
+			job = currentJob;
+		}
+
+		RunJob(*job);
+		lastJob = std::move(job);
+	}
+}
+
+void BuildingCompatibilityTableBuilder::RunJob(Job& job)
+{
+	const uint32_t chunkCount = job.table->GetChunkCount();
+
+	while (!job.canceled.load(std::memory_order_relaxed))
+	{
+		const uint32_t chunk = job.nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+		if (chunk >= chunkCount)
+		{
+			break;
+		}
+
+		ProcessChunk(job, chunk);
+
+		if (job.completedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount)
+		{
+			// This thread finished the last chunk, the other workers have
+			// written all of their results.
+			std::scoped_lock lock(mutex);
+
+			if (!job.canceled)
+			{
+				readyTable.store(job.table, std::memory_order_release);
+				readyEpoch.store(job.table->GetEpoch(), std::memory_order_release);
+				hasReadyTable = true;
+			}
+		}
+	}
+}
+
+void BuildingCompatibilityTableBuilder::ProcessChunk(Job& job, uint32_t chunk)
+{
+	const BuildingStyleCatalog& catalog = *job.pCatalog;
+	const std::span<const StyleMask::word_type> activeStyleMask = job.activeStyleMask.words();
+	const std::span<uint32_t> words = job.table->GetChunkWords(chunk);
+
+	const uint32_t firstRecord = chunk * BuildingCompatibilityTable::RecordsPerChunk;
+	const uint32_t lastRecord = std::min(firstRecord + BuildingCompatibilityTable::RecordsPerChunk, job.table->GetRecordCount());
+
+	for (uint32_t recordIndex = firstRecord; recordIndex < lastRecord; recordIndex++)
+	{
+		const BuildingStyleRecord& record = catalog.get_record(recordIndex);
+
+		const bool compatible = StyleMask::Intersects(activeStyleMask, catalog.get_style_mask(record))
+			|| (!job.unindexedStyles.empty()
+				&& StyleListSearch::FindFirstCommonValue(job.unindexedStyles, catalog.get_styles(record)).has_value());
+
+		if (compatible)
+		{
+			const uint32_t bit = recordIndex - firstRecord;
+
+			words[bit / 32] |= 1U << (bit % 32);
+		}
+	}
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "BuildingCompatibilityTable.h"
+#include "StyleContextSnapshot.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class BuildingStyleCatalog;
+
+// Rebuilds the BuildingCompatibilityTable on a pool of worker threads.
+//
+// The workers only read the catalog and the style context snapshot, which do
+// not change while a rebuild is in progress. The growth hooks keep using their
+// standard style checks until the table for the current epoch is ready, the
+// finished table is published with an atomic pointer swap.
+class BuildingCompatibilityTableBuilder
+{
+public:
+	struct Status
+	{
+		// The epoch of the rebuild that is in progress, or of the last finished rebuild.
+		uint32_t epoch;
+		uint32_t completedChunks;
+		uint32_t chunkCount;
+		uint32_t workerCount;
+		bool ready;
+	};
+
+	BuildingCompatibilityTableBuilder();
+	~BuildingCompatibilityTableBuilder();
+
+	// Starts rebuilding the table for the snapshot's styles, any rebuild that
+	// is in progress is canceled.
+	// This must be called on the game thread after the catalog has been initialized.
+	void Rebuild(std::shared_ptr<const StyleContextSnapshot> snapshot, const BuildingStyleCatalog& catalog);
+
+	// Gets the table that was built for the specified epoch, or nullptr if it is not ready.
+	// This must be called on the game thread, the table remains valid until the next call.
+	const BuildingCompatibilityTable* GetTable(uint32_t epoch);
+
+	Status GetStatus() const;
+
+	// Stops the worker threads.
+	// This must be called before the DLL is unloaded, the threads cannot be
+	// joined while the loader lock is held.
+	void Shutdown();
+
+private:
+	struct Job;
+
+	void StartWorkers();
+	void WorkerThread(std::stop_token stopToken);
+	void RunJob(Job& job);
+	static void ProcessChunk(Job& job, uint32_t chunk);
+
+	std::vector<std::jthread> workers;
+	mutable std::mutex mutex;
+	std::condition_variable_any jobAvailable;
+	std::shared_ptr<Job> currentJob;
+	std::atomic<std::shared_ptr<const BuildingCompatibilityTable>> readyTable;
+	std::atomic<uint32_t> readyEpoch;
+	bool hasReadyTable;
+	// The game thread's reference to the last table that GetTable returned.
+	std::shared_ptr<const BuildingCompatibilityTable> gameThreadTable;
+};
@@ -29,6 +29,7 @@
 #include "cISC4TractDeveloper.h"
 #include "cRZAutoRefCount.h"
 #include "GZWinUtil.h"
+#include "StyleContextSnapshot.h"
 #include "TractDeveloperHooks.h"
 
 static constexpr uint32_t BuildingSelectWinContextTypeID = 0xB9757739;
@@ -241,6 +242,8 @@ void BuildingSelectWinContext::LoadFromDBSegment(cIGZPersistDBSegment* pSegment)
 			}
 		}
 	}
+
+	PublishStyleContextSnapshot();
 }
 
 void BuildingSelectWinContext::SaveToDBSegment(cIGZPersistDBSegment* pSegment) const
@@ -374,6 +377,8 @@ void BuildingSelectWinContext::SetOptionalCheckBoxState(uint32_t buttonID, bool
 		preventCrossStyleRedevelopment = checked;
 		break;
 	}
+
+	PublishStyleContextSnapshot();
 }
 
 IBuildingSelectWinContext::WallToWallOption BuildingSelectWinContext::GetWallToWallOption() const
@@ -384,6 +389,7 @@ IBuildingSelectWinContext::WallToWallOption BuildingSelectWinContext::GetWallToW
 void BuildingSelectWinContext::SetWallToWallOption(WallToWallOption value)
 {
 	wallToWallOption = value;
+	PublishStyleContextSnapshot();
 }
 
 LotZoningOptions BuildingSelectWinContext::GetLotZoningOptions() const
@@ -407,3 +413,13 @@ void BuildingSelectWinContext::SetLotZoningOption(LotZoningOptions option, bool
 		lotZoningOption = static_cast<LotZoningOptions>(lotZoningOption & ~option);
 	}
 }
+
+void BuildingSelectWinContext::PublishStyleContextSnapshot() const
+{
+	StyleContextSnapshot snapshot = StyleContext::Get();
+	snapshot.wallToWallOption = wallToWallOption;
+	snapshot.lotZoningOptions = lotZoningOption;
+	snapshot.preventCrossStyleRedevelopment = preventCrossStyleRedevelopment;
+
+	StyleContext::Publish(std::move(snapshot));
+}
@@ -68,6 +68,8 @@ private:
 	};
 
 	void SetLotZoningOption(LotZoningOptions option, bool value);
+	// Publishes the options that the growth hooks use.
+	void PublishStyleContextSnapshot() const;
 
 	cISC4TractDeveloper* pTractDeveloper;
 	bool automaticallyMarkBuildingsAsHistorical;
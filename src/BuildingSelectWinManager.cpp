@@ -39,6 +39,7 @@
 #include "GZCLSIDDefs.h"
 #include "Logger.h"
 #include "LuaExtensionRegistration.h"
+#include "TractDeveloperHooks.h"
 
 #include <array>
 
@@ -278,6 +279,7 @@ void BuildingSelectWinManager::PostCityInit(cIGZMessage2Standard* pStandardMsg)
 	// This must by done in PostCityInit because SC4 doesn't load the "Building Select"
 	// dialog until it is loading a city.
 	availableBuildingStyles.Initialize();
+	TractDeveloperHooks::AvailableStylesChanged();
 
 	cISC4City* pCity = reinterpret_cast<cISC4City*>(pStandardMsg->GetIGZUnknown());
 
@@ -294,7 +296,17 @@ void BuildingSelectWinManager::PostCityInit(cIGZMessage2Standard* pStandardMsg)
 		// These buildings will be logged as an error and fall back to using the Maxis styles.
 		// This check will only be performed when loading the first city, it isn't necessary
 		// to perform it more than once per game session.
-		unavailableUIBuildingStyles.Initialize(*pCity, availableBuildingStyles.GetBuildingStyles());
+		unavailableUIBuildingStyles.Initialize(
+			*pCity,
+			availableBuildingStyles.GetBuildingStyles(),
+			buildingStylePostingLists);
+
+		// Cache the style information for all of the building exemplars, this must be done
+		// after the unavailable UI styles have been initialized.
+		buildingStyleCatalog.Initialize(*pCity, availableBuildingStyles.GetBuildingStyleIndex());
+
+		// The city's active styles were loaded from the save game.
+		TractDeveloperHooks::ActiveStylesChanged();
 	}
 }
 
@@ -425,6 +437,21 @@ const BuildingStyleCollection& BuildingSelectWinManager::GetAvailableBuildingSty
 	return availableBuildingStyles.GetBuildingStyles();
 }
 
+const BuildingStyleCatalog& BuildingSelectWinManager::GetBuildingStyleCatalog() const
+{
+	return buildingStyleCatalog;
+}
+
+const BuildingStylePostingLists& BuildingSelectWinManager::GetBuildingStylePostingLists() const
+{
+	return buildingStylePostingLists;
+}
+
+const BuildingStyleIndex& BuildingSelectWinManager::GetBuildingStyleIndex() const
+{
+	return availableBuildingStyles.GetBuildingStyleIndex();
+}
+
 IBuildingSelectWinContext& BuildingSelectWinManager::GetContext()
 {
 	return context;
@@ -61,6 +61,9 @@ private:
 
 	bool IsStyleButtonIDValid(uint32_t style) const override;
 	const BuildingStyleCollection& GetAvailableBuildingStyles() const override;
+	const BuildingStyleCatalog& GetBuildingStyleCatalog() const override;
+	const BuildingStylePostingLists& GetBuildingStylePostingLists() const override;
+	const BuildingStyleIndex& GetBuildingStyleIndex() const override;
 
 	IBuildingSelectWinContext& GetContext() override;
 	const IBuildingSelectWinContext& GetContext() const override;
@@ -77,6 +80,8 @@ private:
 	AvailableBuildingStyles availableBuildingStyles;
 	BuildingSelectWinContext context;
 	UnavailableUIBuildingStyles unavailableUIBuildingStyles;
+	BuildingStyleCatalog buildingStyleCatalog;
+	BuildingStylePostingLists buildingStylePostingLists;
 	bool initialized;
 };
 
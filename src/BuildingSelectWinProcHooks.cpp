@@ -48,6 +48,7 @@
 #include "MaxisBuildingStyleUIControlIDs.h"
 #include "Patcher.h"
 #include "SC4VersionDetection.h"
+#include "TractDeveloperHooks.h"
 #include "GZWinUtil.h"
 #include "cIGZWin.h"
 #include "cIGZWinBtn.h"
@@ -412,6 +413,7 @@ void __thiscall cSC4BuildingSelectWinProc::AddActiveStyle(uint32_t buttonID)
 		{
 			activeStyles.push_back(entry.styleID);
 			pTractDeveloper->SetActiveStyles(activeStyles);
+			TractDeveloperHooks::ActiveStyleToggled(pTractDeveloper, entry.styleID, true);
 
 			spBuildingSelectWinManager->SendActiveBuildingStyleCheckboxChangedMessage(true,	entry);
 		}
@@ -448,6 +450,7 @@ void __thiscall cSC4BuildingSelectWinProc::RemoveActiveStyle(uint32_t buttonID)
 		if (itemRemoved)
 		{
 			pTractDeveloper->SetActiveStyles(activeStyles);
+			TractDeveloperHooks::ActiveStyleToggled(pTractDeveloper, entry.styleID, false);
 			spBuildingSelectWinManager->SendActiveBuildingStyleCheckboxChangedMessage(false, entry);
 		}
 	}
@@ -20,8 +20,8 @@
  */
 
 #pragma once
+#include <array>
 #include <cstdint>
-#include "frozen/unordered_set.h"
 
 // The button ids in this file are used to provide additional functionality in
 // the building style dialog beyond just allowing the user to add new styles.
@@ -52,7 +52,7 @@ static constexpr uint32_t WallToWallBlockRadioButtonID = 0x3115038B;
 // the zoned area to fit the lot it picks for that location.
 static constexpr uint32_t KeepLotZoneSizesButtonID = 0x3621731B;
 
-constexpr frozen::unordered_set<uint32_t, 6> OptionalButtonIDs =
+constexpr std::array<uint32_t, 6> OptionalButtonIDs =
 {
 	AutoHistoricalButtonID,
 	AutoGrowifyButtonID,
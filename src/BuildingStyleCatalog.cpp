@@ -0,0 +1,226 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BuildingStyleCatalog.h"
+#include "BuildingStyleIndex.h"
+#include "BuildingStyleUtil.h"
+#include "BuildingUtil.h"
+#include "cGZPersistResourceKey.h"
+#include "cIGZPersistResourceManager.h"
+#include "cISC4BuildingDevelopmentSimulator.h"
+#include "cISC4City.h"
+#include "cISCPropertyHolder.h"
+#include "cRZAutoRefCount.h"
+#include "GZServPtrs.h"
+#include "Logger.h"
+#include <algorithm>
+
+BuildingStyleRecord::BuildingStyleRecord()
+	: index(0),
+	  stylesOffset(0),
+	  styleCount(0),
+	  styleMaskOffset(0),
+	  industryOccupantGroup(0),
+	  flags(FlagNone)
+{
+}
+
+bool BuildingStyleRecord::HasBuildingStylesProperty() const
+{
+	return (flags & FlagHasBuildingStylesProperty) != 0;
+}
+
+bool BuildingStyleRecord::IsWallToWall() const
+{
+	return (flags & FlagWallToWall) != 0;
+}
+
+BuildingStyleCatalog::BuildingStyleCatalog()
+	: records(),
+	  recordsByIndex(),
+	  stylePool(),
+	  pStyleIndex(nullptr),
+	  styleMaskPool(),
+	  buildingTypesByStyleIndex(),
+	  styleMaskWordCount(0),
+	  initialized(false)
+{
+}
+
+void BuildingStyleCatalog::Initialize(cISC4City& city, const BuildingStyleIndex& styleIndex)
+{
+	// The available UI styles and the building exemplars do not change after
+	// the first city is loaded, so the catalog only needs to be built once
+	// per game session.
+	if (!initialized)
+	{
+		initialized = true;
+
+		pStyleIndex = &styleIndex;
+		styleMaskWordCount = StyleMask::GetWordCount(styleIndex.GetStyleIndexCount());
+		buildingTypesByStyleIndex.resize(styleIndex.GetStyleIndexCount());
+
+		cIGZPersistResourceManagerPtr pRM;
+
+		if (pRM)
+		{
+			cISC4BuildingDevelopmentSimulator* pBuildingDevelopmentSim = city.GetBuildingDevelopmentSimulator();
+
+			if (pBuildingDevelopmentSim)
+			{
+				const std::vector<uint32_t> allBuildingTypes = BuildingUtil::GetAllBuildingTypes(*pBuildingDevelopmentSim);
+
+				records.reserve(allBuildingTypes.size());
+				recordsByIndex.reserve(allBuildingTypes.size());
+
+				for (const uint32_t& buildingType : allBuildingTypes)
+				{
+					cGZPersistResourceKey key;
+
+					if (pBuildingDevelopmentSim->GetBuildingKeyFromType(buildingType, key))
+					{
+						cRZAutoRefCount<cISCPropertyHolder> pPropertyHolder;
+
+						if (pRM->GetResource(key, GZIID_cISCPropertyHolder, pPropertyHolder.AsPPVoid(), 0, nullptr))
+						{
+							AddRecord(buildingType, pPropertyHolder);
+						}
+					}
+				}
+
+				for (std::vector<uint32_t>& buildingTypes : buildingTypesByStyleIndex)
+				{
+					std::sort(buildingTypes.begin(), buildingTypes.end());
+				}
+
+				Logger::GetInstance().WriteLineFormatted(
+					LogLevel::Info,
+					"Cached the style information for %u buildings.",
+					static_cast<uint32_t>(records.size()));
+			}
+		}
+	}
+}
+
+bool BuildingStyleCatalog::IsInitialized() const
+{
+	return initialized;
+}
+
+const BuildingStyleRecord* BuildingStyleCatalog::find(uint32_t buildingType) const
+{
+	const auto it = records.find(buildingType);
+
+	return it != records.end() ? &it->second : nullptr;
+}
+
+const BuildingStyleRecord& BuildingStyleCatalog::get_record(uint32_t index) const
+{
+	return *recordsByIndex[index];
+}
+
+std::span<const uint32_t> BuildingStyleCatalog::get_styles(const BuildingStyleRecord& record) const
+{
+	return std::span<const uint32_t>(stylePool.data() + record.stylesOffset, record.styleCount);
+}
+
+std::span<const StyleMask::word_type> BuildingStyleCatalog::get_style_mask(const BuildingStyleRecord& record) const
+{
+	return std::span<const StyleMask::word_type>(styleMaskPool.data() + record.styleMaskOffset, styleMaskWordCount);
+}
+
+size_t BuildingStyleCatalog::size() const
+{
+	return records.size();
+}
+
+std::optional<uint32_t> BuildingStyleCatalog::GetStyleIndex(uint32_t style) const
+{
+	return pStyleIndex ? pStyleIndex->GetStyleIndex(style) : std::nullopt;
+}
+
+uint32_t BuildingStyleCatalog::GetStyleFromIndex(uint32_t index) const
+{
+	return pStyleIndex->GetStyleFromIndex(index);
+}
+
+size_t BuildingStyleCatalog::GetStyleIndexCount() const
+{
+	return pStyleIndex ? pStyleIndex->GetStyleIndexCount() : 0;
+}
+
+std::span<const uint32_t> BuildingStyleCatalog::GetBuildingTypesWithStyleIndex(uint32_t index) const
+{
+	return buildingTypesByStyleIndex[index];
+}
+
+void BuildingStyleCatalog::AddRecord(uint32_t buildingType, cISCPropertyHolder* pPropertyHolder)
+{
+	BuildingStyleRecord record;
+	record.index = static_cast<uint32_t>(recordsByIndex.size());
+
+	const BuildingStyleUtil::BuildingStyleProperties properties = BuildingStyleUtil::ReadBuildingStyleProperties(pPropertyHolder);
+
+	if (properties.isWallToWall)
+	{
+		record.flags |= BuildingStyleRecord::FlagWallToWall;
+	}
+
+	if (properties.hasBuildingStylesProperty)
+	{
+		record.flags |= BuildingStyleRecord::FlagHasBuildingStylesProperty;
+	}
+
+	record.industryOccupantGroup = properties.industryOccupantGroup;
+
+	// Buildings without a usable Building Styles property use the
+	// Maxis styles in their Occupant Groups.
+	const std::span<const uint32_t> styles = properties.GetStyles();
+
+	record.stylesOffset = static_cast<uint32_t>(stylePool.size());
+	record.styleCount = static_cast<uint32_t>(styles.size());
+	stylePool.insert(stylePool.end(), styles.begin(), styles.end());
+
+	record.styleMaskOffset = static_cast<uint32_t>(styleMaskPool.size());
+	styleMaskPool.resize(styleMaskPool.size() + styleMaskWordCount);
+
+	const std::span<StyleMask::word_type> styleMask(styleMaskPool.data() + record.styleMaskOffset, styleMaskWordCount);
+
+	for (const uint32_t& style : get_styles(record))
+	{
+		const std::optional<uint32_t> index = GetStyleIndex(style);
+
+		// The style list can contain the same style more than once.
+		if (index.has_value() && !StyleMask::TestBit(styleMask, index.value()))
+		{
+			StyleMask::SetBit(styleMask, index.value());
+			buildingTypesByStyleIndex[index.value()].push_back(buildingType);
+		}
+	}
+
+	const auto [it, inserted] = records.emplace(buildingType, record);
+
+	if (inserted)
+	{
+		// The unordered_map nodes are not moved when the map is rehashed.
+		recordsByIndex.push_back(&it->second);
+	}
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "StyleMask.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class BuildingStyleIndex;
+class cISC4City;
+class cISCPropertyHolder;
+
+struct BuildingStyleRecord
+{
+	enum Flags : uint8_t
+	{
+		FlagNone = 0,
+		// The building has a Building Styles property that contains at least one
+		// style id that is present in the UI.
+		// When this flag is not set, the record's style list contains the
+		// building's Occupant Groups.
+		FlagHasBuildingStylesProperty = 1 << 0,
+		// The building is Wall-to-Wall (W2W).
+		FlagWallToWall = 1 << 1,
+	};
+
+	// The records are numbered in the order that they were added to the catalog.
+	uint32_t index;
+	uint32_t stylesOffset;
+	uint32_t styleCount;
+	uint32_t styleMaskOffset;
+	// The industry type occupant group (0x3000-0x3002), or 0 if the building doesn't have one.
+	uint32_t industryOccupantGroup;
+	uint8_t flags;
+
+	BuildingStyleRecord();
+
+	bool HasBuildingStylesProperty() const;
+	bool IsWallToWall() const;
+};
+
+// Caches the style information for every building exemplar, this allows
+// the growth hooks to avoid loading the exemplar and reading its properties
+// each time the game tests a building.
+class BuildingStyleCatalog
+{
+public:
+	BuildingStyleCatalog();
+
+	// Reads the style information from all of the building exemplars.
+	// This must be called after the available and unavailable UI styles
+	// have been initialized.
+	// The style index must remain valid for the lifetime of the catalog.
+	void Initialize(cISC4City& city, const BuildingStyleIndex& styleIndex);
+
+	bool IsInitialized() const;
+
+	const BuildingStyleRecord* find(uint32_t buildingType) const;
+
+	const BuildingStyleRecord& get_record(uint32_t index) const;
+
+	std::span<const uint32_t> get_styles(const BuildingStyleRecord& record) const;
+
+	// Gets a StyleMask with the bits set for the indexed styles in the record's style list.
+	std::span<const StyleMask::word_type> get_style_mask(const BuildingStyleRecord& record) const;
+
+	size_t size() const;
+
+	// The dense style indexes are assigned to the available UI styles and the Maxis styles
+	// by the BuildingStyleIndex.
+	std::optional<uint32_t> GetStyleIndex(uint32_t style) const;
+	uint32_t GetStyleFromIndex(uint32_t index) const;
+	size_t GetStyleIndexCount() const;
+
+	// Gets a sorted list of the building types whose style list contains the indexed style.
+	std::span<const uint32_t> GetBuildingTypesWithStyleIndex(uint32_t index) const;
+
+private:
+	void AddRecord(uint32_t buildingType, cISCPropertyHolder* pPropertyHolder);
+
+	std::unordered_map<uint32_t, BuildingStyleRecord> records;
+	std::vector<const BuildingStyleRecord*> recordsByIndex;
+	std::vector<uint32_t> stylePool;
+	const BuildingStyleIndex* pStyleIndex;
+	std::vector<StyleMask::word_type> styleMaskPool;
+	std::vector<std::vector<uint32_t>> buildingTypesByStyleIndex;
+	size_t styleMaskWordCount;
+	bool initialized;
+};
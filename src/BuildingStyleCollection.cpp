@@ -27,18 +27,24 @@ BuildingStyleCollection::BuildingStyleCollection()
 }
 
 BuildingStyleCollection::BuildingStyleCollection(const BuildingStyleCollection& other)
-	: entries(other.entries)
+	: entries(other.entries),
+	  buttonIndexes(other.buttonIndexes),
+	  styleIndexes(other.styleIndexes)
 {
 }
 
 BuildingStyleCollection::BuildingStyleCollection(BuildingStyleCollection&& other) noexcept
-	: entries(std::move(other.entries))
+	: entries(std::move(other.entries)),
+	  buttonIndexes(std::move(other.buttonIndexes)),
+	  styleIndexes(std::move(other.styleIndexes))
 {
 }
 
 BuildingStyleCollection& BuildingStyleCollection::operator=(const BuildingStyleCollection& other)
 {
 	entries = other.entries;
+	buttonIndexes = other.buttonIndexes;
+	styleIndexes = other.styleIndexes;
 
 	return *this;
 }
@@ -46,25 +52,17 @@ BuildingStyleCollection& BuildingStyleCollection::operator=(const BuildingStyleC
 BuildingStyleCollection& BuildingStyleCollection::operator=(BuildingStyleCollection&& other) noexcept
 {
 	entries = std::move(other.entries);
+	buttonIndexes = std::move(other.buttonIndexes);
+	styleIndexes = std::move(other.styleIndexes);
 
 	return *this;
 }
 
-BuildingStyleCollection::iterator BuildingStyleCollection::begin()
-{
-	return entries.begin();
-}
-
 BuildingStyleCollection::const_iterator BuildingStyleCollection::begin() const
 {
 	return entries.begin();
 }
 
-BuildingStyleCollection::iterator BuildingStyleCollection::end()
-{
-	return entries.end();
-}
-
 BuildingStyleCollection::const_iterator BuildingStyleCollection::end() const
 {
 	return entries.end();
@@ -92,24 +90,16 @@ bool BuildingStyleCollection::empty() const
 
 BuildingStyleCollection::const_iterator BuildingStyleCollection::find_button(uint32_t buttonID) const
 {
-	return std::find_if(
-		entries.begin(),
-		entries.end(),
-		[buttonID](const BuildingStyleCollectionEntry& e)
-		{
-			return e.buttonID == buttonID;
-		});
+	const auto it = buttonIndexes.find(buttonID);
+
+	return it != buttonIndexes.end() ? entries.begin() + it->second : entries.end();
 }
 
 BuildingStyleCollection::const_iterator BuildingStyleCollection::find_style(uint32_t styleID) const
 {
-	return std::find_if(
-		entries.begin(),
-		entries.end(),
-		[styleID](const BuildingStyleCollectionEntry& e)
-		{
-			return e.styleID == styleID;
-		});
+	const auto it = styleIndexes.find(styleID);
+
+	return it != styleIndexes.end() ? entries.begin() + it->second : entries.end();
 }
 
 void BuildingStyleCollection::insert(
@@ -119,6 +109,7 @@ void BuildingStyleCollection::insert(
 {
 	if (!contains_button(buttonID))
 	{
+		add_indexes(buttonID, styleID);
 		entries.emplace_back(buttonID, styleID, styleName);
 	}
 }
@@ -130,6 +121,7 @@ void BuildingStyleCollection::insert(
 {
 	if (!contains_button(buttonID))
 	{
+		add_indexes(buttonID, styleID);
 		entries.emplace_back(buttonID, styleID, styleName);
 	}
 }
@@ -138,6 +130,7 @@ void BuildingStyleCollection::insert(const BuildingStyleCollectionEntry& entry)
 {
 	if (!contains(entry))
 	{
+		add_indexes(entry.buttonID, entry.styleID);
 		entries.push_back(entry);
 	}
 }
@@ -145,6 +138,8 @@ void BuildingStyleCollection::insert(const BuildingStyleCollectionEntry& entry)
 void BuildingStyleCollection::reserve(size_t size)
 {
 	entries.reserve(size);
+	buttonIndexes.reserve(size);
+	styleIndexes.reserve(size);
 }
 
 size_t BuildingStyleCollection::size() const
@@ -152,3 +147,26 @@ size_t BuildingStyleCollection::size() const
 	return entries.size();
 }
 
+void BuildingStyleCollection::sort()
+{
+	std::sort(entries.begin(), entries.end());
+
+	buttonIndexes.clear();
+	styleIndexes.clear();
+
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		buttonIndexes.emplace(entries[i].buttonID, i);
+		styleIndexes.emplace(entries[i].styleID, i);
+	}
+}
+
+void BuildingStyleCollection::add_indexes(uint32_t buttonID, uint32_t styleID)
+{
+	const size_t index = entries.size();
+
+	buttonIndexes.emplace(buttonID, index);
+	// The first entry with a style id is kept, this matches the previous linear search.
+	styleIndexes.emplace(styleID, index);
+}
+
@@ -21,13 +21,19 @@
 
 #pragma once
 #include "BuildingStyleCollectionEntry.h"
+#include <unordered_map>
 #include <vector>
 
+// A collection of building style entries that preserves the insertion order.
+// The entries are indexed by their button and style ids, so the find methods
+// do not need to search the collection.
 class BuildingStyleCollection final
 {
 public:
 	using container = std::vector<BuildingStyleCollectionEntry>;
-	using iterator = container::iterator;
+	// The entries are read-only, changing an entry's button or style id
+	// would leave the indexes pointing at the wrong entry.
+	using iterator = container::const_iterator;
 	using const_iterator = container::const_iterator;
 
 	BuildingStyleCollection();
@@ -37,9 +43,7 @@ public:
 	BuildingStyleCollection& operator=(const BuildingStyleCollection& other);
 	BuildingStyleCollection& operator=(BuildingStyleCollection&& other) noexcept;
 
-	iterator begin();
 	const_iterator begin() const;
-	iterator end();
 	const_iterator end() const;
 
 	bool contains(const BuildingStyleCollectionEntry& entry) const;
@@ -56,7 +60,18 @@ public:
 	void reserve(size_t size);
 	size_t size() const;
 
+	// Sorts the entries in ascending order.
+	// This must be used instead of sorting the iterators, the indexes are rebuilt
+	// after the entries are sorted.
+	void sort();
+
 private:
+	void add_indexes(uint32_t buttonID, uint32_t styleID);
+
 	container entries;
+	// The index of the entry that uses the button or style id.
+	// If more than one entry uses the same style id, the first one is indexed.
+	std::unordered_map<uint32_t, size_t> buttonIndexes;
+	std::unordered_map<uint32_t, size_t> styleIndexes;
 };
 
@@ -0,0 +1,106 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BuildingStyleIndex.h"
+#include "BuildingStyleCollection.h"
+
+BuildingStyleIndex::BuildingStyleIndex()
+	: styleIndexes(),
+	  indexedStyles(),
+	  initialized(false)
+{
+}
+
+void BuildingStyleIndex::Initialize(const BuildingStyleCollection& availableStyles)
+{
+	if (!initialized)
+	{
+		initialized = true;
+
+		styleIndexes.reserve(availableStyles.size() + 4);
+		indexedStyles.reserve(availableStyles.size() + 4);
+
+		for (uint32_t style = 0x2000; style <= 0x2003; style++)
+		{
+			AddStyleIndex(style);
+		}
+
+		for (const BuildingStyleCollectionEntry& entry : availableStyles)
+		{
+			AddStyleIndex(entry.styleID);
+		}
+	}
+}
+
+bool BuildingStyleIndex::IsInitialized() const
+{
+	return initialized;
+}
+
+std::optional<uint32_t> BuildingStyleIndex::GetStyleIndex(uint32_t style) const
+{
+	std::optional<uint32_t> result;
+
+	const auto it = styleIndexes.find(style);
+
+	if (it != styleIndexes.end())
+	{
+		result = it->second;
+	}
+
+	return result;
+}
+
+uint32_t BuildingStyleIndex::GetStyleFromIndex(uint32_t index) const
+{
+	return indexedStyles[index];
+}
+
+size_t BuildingStyleIndex::GetStyleIndexCount() const
+{
+	return indexedStyles.size();
+}
+
+StyleMask BuildingStyleIndex::CreateStyleMask(std::span<const uint32_t> styles) const
+{
+	StyleMask mask;
+	mask.reset(indexedStyles.size());
+
+	for (const uint32_t& style : styles)
+	{
+		const std::optional<uint32_t> index = GetStyleIndex(style);
+
+		if (index.has_value())
+		{
+			mask.set(index.value());
+		}
+	}
+
+	return mask;
+}
+
+void BuildingStyleIndex::AddStyleIndex(uint32_t style)
+{
+	if (styleIndexes.try_emplace(style, static_cast<uint32_t>(indexedStyles.size())).second)
+	{
+		indexedStyles.push_back(style);
+	}
+}
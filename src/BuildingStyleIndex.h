@@ -0,0 +1,61 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "StyleMask.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class BuildingStyleCollection;
+
+// Maps the available style ids to dense indexes in the range [0, GetStyleIndexCount()).
+// The Maxis styles are assigned the first indexes, followed by the available UI styles
+// in the collection's order.
+//
+// The indexes are assigned when the available styles are initialized for the first
+// city, they do not change for the rest of the game session.
+class BuildingStyleIndex
+{
+public:
+	BuildingStyleIndex();
+
+	void Initialize(const BuildingStyleCollection& availableStyles);
+
+	bool IsInitialized() const;
+
+	std::optional<uint32_t> GetStyleIndex(uint32_t style) const;
+	uint32_t GetStyleFromIndex(uint32_t index) const;
+	size_t GetStyleIndexCount() const;
+
+	// Creates a StyleMask with the bits set for the indexed styles in the list.
+	// Styles that do not have an index are ignored.
+	StyleMask CreateStyleMask(std::span<const uint32_t> styles) const;
+
+private:
+	void AddStyleIndex(uint32_t style);
+
+	std::unordered_map<uint32_t, uint32_t> styleIndexes;
+	std::vector<uint32_t> indexedStyles;
+	bool initialized;
+};
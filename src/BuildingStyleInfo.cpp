@@ -31,14 +31,40 @@
 #include "cRZAutoRefCount.h"
 #include "cRZBaseString.h"
 #include "GlobalPointers.h"
+#include "BuildingStyleIndex.h"
 #include "IBuildingSelectWinManager.h"
-#include "PropertyData.h"
-#include "PropertyIDs.h"
+#include "PropertyView.h"
 #include "StringResourceKey.h"
 #include "StringResourceManager.h"
+#include <algorithm>
+#include <span>
 
 namespace
 {
+	uint32_t CopyToArray(std::span<const uint32_t> values, uint32_t* pDestination, uint32_t size)
+	{
+		uint32_t count = 0;
+
+		if (pDestination)
+		{
+			count = static_cast<uint32_t>(std::min(values.size(), static_cast<size_t>(size)));
+
+			std::copy_n(values.begin(), count, pDestination);
+		}
+		else
+		{
+			// If the array pointer is null and the size is 0, we return the total
+			// number of items.
+			// If the size is not zero that is an API usage error, and we return 0.
+			if (size == 0)
+			{
+				count = static_cast<uint32_t>(values.size());
+			}
+		}
+
+		return count;
+	}
+
 	template <bool useFallbackStyleName>
 	bool AppendBuildingStyleName(
 		const BuildingStyleCollection& availableBuildingStyles,
@@ -72,7 +98,7 @@ namespace
 
 	template <bool useFallbackStyleName>
 	void GetStyleNamesFromPropertyData(
-		const PropertyData<uint32_t>& propertyData,
+		const PropertyView<uint32_t>& propertyData,
 		const BuildingStyleCollection& availableBuildingStyles,
 		cIGZString& destination,
 		const cIGZString& separator)
@@ -142,6 +168,13 @@ bool BuildingStyleInfo::QueryInterface(uint32_t riid, void** ppvObj)
 
 		return true;
 	}
+	else if (riid == GZIID_cIBuildingStyleInfo3)
+	{
+		*ppvObj = static_cast<cIBuildingStyleInfo3*>(this);
+		AddRef();
+
+		return true;
+	}
 	else if (riid == GZIID_cIGZUnknown)
 	{
 		*ppvObj = static_cast<cIGZUnknown*>(this);
@@ -247,12 +280,12 @@ bool BuildingStyleInfo::GetBuildingStyleNamesEx(
 
 			if (pPropertyHolder)
 			{
-				PropertyData<uint32_t> propertyData;
+				const BuildingStyleUtil::BuildingStyleProperties properties = BuildingStyleUtil::ReadBuildingStyleProperties(pPropertyHolder);
 
-				if (BuildingStyleUtil::TryReadBuildingStylesProperty(pPropertyHolder, propertyData))
+				if (properties.hasBuildingStylesProperty)
 				{
 					GetStyleNamesFromPropertyData<true>(
-						propertyData,
+						properties.buildingStyles,
 						availableBuildingStyles,
 						destination,
 						separator);
@@ -278,10 +311,10 @@ bool BuildingStyleInfo::GetBuildingStyleNamesEx(
 							destination.Copy(*temp);
 						}
 					}
-					else if (propertyData.load(pPropertyHolder, kOccupantGroupsProperty))
+					else if (properties.occupantGroups)
 					{
 						GetStyleNamesFromPropertyData<false>(
-							propertyData,
+							properties.occupantGroups,
 							availableBuildingStyles,
 							destination,
 							separator);
@@ -301,3 +334,61 @@ bool BuildingStyleInfo::IsWallToWall(cISC4Occupant* pBuildingOccupant) const
 {
 	return BuildingUtil::IsWallToWall(pBuildingOccupant);
 }
+
+uint32_t BuildingStyleInfo::GetBuildingTypesWithStyle(uint32_t value, uint32_t* pBuildingTypes, uint32_t size) const
+{
+	return CopyToArray(
+		buildingWinManager.GetBuildingStylePostingLists().GetBuildingTypes(value),
+		pBuildingTypes,
+		size);
+}
+
+uint32_t BuildingStyleInfo::GetLotConfigurationIdsWithStyle(
+	uint32_t value,
+	uint32_t* pLotConfigurationIds,
+	uint32_t size) const
+{
+	return CopyToArray(
+		buildingWinManager.GetBuildingStylePostingLists().GetLotConfigurationIDs(value),
+		pLotConfigurationIds,
+		size);
+}
+
+bool BuildingStyleInfo::GetStyleIndex(uint32_t style, uint32_t& index) const
+{
+	const std::optional<uint32_t> styleIndex = buildingWinManager.GetBuildingStyleIndex().GetStyleIndex(style);
+
+	if (styleIndex)
+	{
+		index = styleIndex.value();
+		return true;
+	}
+
+	return false;
+}
+
+uint32_t BuildingStyleInfo::GetStyleIndexCount() const
+{
+	return static_cast<uint32_t>(buildingWinManager.GetBuildingStyleIndex().GetStyleIndexCount());
+}
+
+uint32_t BuildingStyleInfo::GetStyleMask(
+	const uint32_t* pStyles,
+	uint32_t styleCount,
+	uint32_t* pMaskWords,
+	uint32_t size) const
+{
+	uint32_t count = 0;
+
+	if (pStyles || styleCount == 0)
+	{
+		const StyleMask mask = buildingWinManager.GetBuildingStyleIndex().CreateStyleMask(
+			std::span<const uint32_t>(pStyles, styleCount));
+
+		// The mask is always sized for all of the style indexes, so the word
+		// count that is returned for a null array does not depend on the style list.
+		count = CopyToArray(mask.words(), pMaskWords, size);
+	}
+
+	return count;
+}
@@ -20,11 +20,11 @@
  */
 
 #pragma once
-#include "cIBuildingStyleInfo2.h"
+#include "cIBuildingStyleInfo3.h"
 
 class IBuildingSelectWinManager;
 
-class BuildingStyleInfo final : public cIBuildingStyleInfo2
+class BuildingStyleInfo final : public cIBuildingStyleInfo3
 {
 public:
 	BuildingStyleInfo(const IBuildingSelectWinManager& buildingWinManager);
@@ -52,6 +52,25 @@ private:
 
 	bool IsWallToWall(cISC4Occupant* pBuildingOccupant) const override;
 
+	// cIBuildingStyleInfo3
+
+	uint32_t GetBuildingTypesWithStyle(uint32_t value, uint32_t* pBuildingTypes, uint32_t size) const override;
+
+	uint32_t GetLotConfigurationIdsWithStyle(
+		uint32_t value,
+		uint32_t* pLotConfigurationIds,
+		uint32_t size) const override;
+
+	bool GetStyleIndex(uint32_t style, uint32_t& index) const override;
+
+	uint32_t GetStyleIndexCount() const override;
+
+	uint32_t GetStyleMask(
+		const uint32_t* pStyles,
+		uint32_t styleCount,
+		uint32_t* pMaskWords,
+		uint32_t size) const override;
+
 	// Private members
 
 	uint32_t refCount;
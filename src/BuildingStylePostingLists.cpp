@@ -0,0 +1,126 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BuildingStylePostingLists.h"
+#include "LotConfigurationManagerHooks.h"
+#include "LotConfigurationStyleIndex.h"
+#include "WallToWallOccupantGroups.h"
+#include <algorithm>
+
+namespace
+{
+	std::span<const uint32_t> GetPostingList(
+		const std::unordered_map<uint32_t, std::vector<uint32_t>>& postingLists,
+		uint32_t value)
+	{
+		const auto it = postingLists.find(value);
+
+		if (it != postingLists.end())
+		{
+			return it->second;
+		}
+
+		return {};
+	}
+
+	void SortAndRemoveDuplicates(std::vector<uint32_t>& values)
+	{
+		std::sort(values.begin(), values.end());
+		values.erase(std::unique(values.begin(), values.end()), values.end());
+		values.shrink_to_fit();
+	}
+}
+
+BuildingStylePostingLists::BuildingStylePostingLists()
+	: buildingTypesByValue(),
+	  lotConfigurationIDsByValue()
+{
+}
+
+void BuildingStylePostingLists::AddBuilding(
+	uint32_t buildingType,
+	std::span<const uint32_t> styles,
+	std::span<const uint32_t> occupantGroups)
+{
+	for (const uint32_t style : styles)
+	{
+		buildingTypesByValue[style].push_back(buildingType);
+	}
+
+	for (const uint32_t occupantGroup : occupantGroups)
+	{
+		if (WallToWallOccupantGroups.count(occupantGroup) != 0)
+		{
+			buildingTypesByValue[occupantGroup].push_back(buildingType);
+		}
+	}
+}
+
+void BuildingStylePostingLists::Finalize(LotConfigurationStyleIndex& lotConfigurationStyleIndex)
+{
+	lotConfigurationIDsByValue.clear();
+
+	for (auto& [value, buildingTypes] : buildingTypesByValue)
+	{
+		SortAndRemoveDuplicates(buildingTypes);
+		AddLotConfigurations(value, lotConfigurationStyleIndex);
+	}
+
+	// The lots with a Building Styles property are listed under the W2W General occupant
+	// group, which may not be used by any of the building exemplars.
+	for (const auto& item : WallToWallOccupantGroups)
+	{
+		if (!buildingTypesByValue.contains(item.first))
+		{
+			AddLotConfigurations(item.first, lotConfigurationStyleIndex);
+		}
+	}
+}
+
+void BuildingStylePostingLists::AddLotConfigurations(
+	uint32_t value,
+	LotConfigurationStyleIndex& lotConfigurationStyleIndex)
+{
+	const std::span<const void* const> lotConfigurations = lotConfigurationStyleIndex.GetLotConfigurationsWithValue(value);
+
+	if (!lotConfigurations.empty())
+	{
+		std::vector<uint32_t>& lotConfigurationIDs = lotConfigurationIDsByValue[value];
+		lotConfigurationIDs.reserve(lotConfigurations.size());
+
+		for (const void* lotConfigurationKey : lotConfigurations)
+		{
+			lotConfigurationIDs.push_back(LotConfigurationManagerHooks::GetLotConfigurationID(lotConfigurationKey));
+		}
+
+		SortAndRemoveDuplicates(lotConfigurationIDs);
+	}
+}
+
+std::span<const uint32_t> BuildingStylePostingLists::GetBuildingTypes(uint32_t value) const
+{
+	return GetPostingList(buildingTypesByValue, value);
+}
+
+std::span<const uint32_t> BuildingStylePostingLists::GetLotConfigurationIDs(uint32_t value) const
+{
+	return GetPostingList(lotConfigurationIDsByValue, value);
+}
@@ -0,0 +1,66 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class LotConfigurationStyleIndex;
+
+// Posting lists from the style ids and wall to wall occupant groups to the building
+// types and lot configuration ids that contain them.
+//
+// The building lists are built during the building exemplar scan that checks for
+// unavailable UI styles, a building is listed under the styles in its Building Styles
+// property, or its Maxis styles when it doesn't have one, and its wall to wall occupant groups.
+// The lot configuration lists use the values that the GetBuildingStyles hook copied into
+// each lot configuration, so a lot whose buildings use the Building Styles property is
+// listed under the BTE: W2W General occupant group instead of its specific W2W group.
+class BuildingStylePostingLists
+{
+public:
+	BuildingStylePostingLists();
+
+	void AddBuilding(
+		uint32_t buildingType,
+		std::span<const uint32_t> styles,
+		std::span<const uint32_t> occupantGroups);
+
+	// Adds the lot configurations for every value that has a building list, and sorts
+	// the lists. This must be called after the last AddBuilding call.
+	void Finalize(LotConfigurationStyleIndex& lotConfigurationStyleIndex);
+
+	// Gets a sorted list of the building types with the specified style or wall to wall
+	// occupant group.
+	std::span<const uint32_t> GetBuildingTypes(uint32_t value) const;
+
+	// Gets a sorted list of the lot configuration ids with the specified style or wall
+	// to wall occupant group.
+	std::span<const uint32_t> GetLotConfigurationIDs(uint32_t value) const;
+
+private:
+	void AddLotConfigurations(uint32_t value, LotConfigurationStyleIndex& lotConfigurationStyleIndex);
+
+	std::unordered_map<uint32_t, std::vector<uint32_t>> buildingTypesByValue;
+	std::unordered_map<uint32_t, std::vector<uint32_t>> lotConfigurationIDsByValue;
+};
@@ -20,11 +20,11 @@
  */
 
 #include "BuildingStyleUtil.h"
-#include "BuildingStyleButtons.h"
+#include "BuildingUtil.h"
 #include "IUnavailableUIBuildingStyles.h"
-#include "MaxisBuildingStyleUIControlIDs.h"
+#include "OccupantGroupClassifier.h"
 #include "PropertyIDs.h"
-#include "ReservedStyleIDs.h"
+#include "StyleCompatibilityEngine.h"
 #include "frozen/unordered_set.h"
 #include <algorithm>
 
@@ -68,7 +68,7 @@ namespace
 		// The PIMX building templates set the ExemplarCategory property to
 		// the template id, which we use to detect the exemplars it modified.
 
-		const PropertyData<uint32_t> exemplarCategory(pPropertyHolder, kExemplarCategoryPropertyID);
+		const PropertyView<uint32_t> exemplarCategory(pPropertyHolder, kExemplarCategoryPropertyID);
 
 		if (exemplarCategory)
 		{
@@ -85,7 +85,7 @@ namespace
 
 	bool IsPIMXStyle2004Placeholder(
 		cISCPropertyHolder* pPropertyHolder,
-		const PropertyData<uint32_t>& buildingStyles)
+		const PropertyView<uint32_t>& buildingStyles)
 	{
 		bool result = false;
 
@@ -121,10 +121,7 @@ bool BuildingStyleUtil::IsReservedStyleID(uint32_t style)
 	// 3. The Maxis Building Style UI control ids.
 	// 4. The DLL's optional Building Style UI control ids.
 
-	return style <= StyleControlReservedButtonRangeEnd
-		|| style == PIMXPlaceholderStyleID
-		|| MaxisUIControlIDs.contains(style)
-		|| OptionalButtonIDs.contains(style);
+	return (OccupantGroupClassifier::Classify(style) & OccupantGroupClassifier::ReservedStyleID) != 0;
 }
 
 bool BuildingStyleUtil::IsStyleIDReservedOrNotInUI(uint32_t style)
@@ -132,14 +129,43 @@ bool BuildingStyleUtil::IsStyleIDReservedOrNotInUI(uint32_t style)
 	return IsReservedStyleID(style) || spUnavailableUIBuildingStyles->Contains(style);
 }
 
-bool BuildingStyleUtil::TryReadBuildingStylesProperty(
-	cISCPropertyHolder* pPropertyHolder,
-	PropertyData<uint32_t>& output)
+BuildingStyleUtil::BuildingStyleProperties::BuildingStyleProperties()
+	: buildingStyles(),
+	  occupantGroups(),
+	  industryOccupantGroup(0),
+	  hasBuildingStylesProperty(false),
+	  usesPIMXPlaceholderFallback(false),
+	  isWallToWall(false)
 {
-	bool result = false;
-	PropertyData<uint32_t> temp(pPropertyHolder, kBuildingStylesProperty);
+}
+
+std::span<const uint32_t> BuildingStyleUtil::BuildingStyleProperties::GetStyles() const
+{
+	return hasBuildingStylesProperty ? buildingStyles.values() : occupantGroups.values();
+}
+
+BuildingStyleUtil::BuildingStyleProperties BuildingStyleUtil::ReadBuildingStyleProperties(
+	cISCPropertyHolder* pPropertyHolder)
+{
+	BuildingStyleProperties properties;
+
+	properties.occupantGroups.load(pPropertyHolder, kOccupantGroupsProperty);
+
+	const uint8_t occupantGroupFlags = OccupantGroupClassifier::ClassifyAll(properties.occupantGroups.values());
 
-	if (temp)
+	if ((occupantGroupFlags & OccupantGroupClassifier::IndustryType) != 0)
+	{
+		properties.industryOccupantGroup = StyleCompatibilityEngine::GetIndustryTypeOccupantGroup(
+			properties.occupantGroups.values());
+	}
+
+	properties.isWallToWall = BuildingUtil::IsWallToWall(
+		pPropertyHolder,
+		(occupantGroupFlags & OccupantGroupClassifier::WallToWall) != 0);
+
+	const PropertyView<uint32_t> buildingStyles(pPropertyHolder, kBuildingStylesProperty);
+
+	if (buildingStyles)
 	{
 		// A Building Styles property set to the PIM-X placeholder style is currently
 		// used on over 100 released buildings.
@@ -157,20 +183,24 @@ bool BuildingStyleUtil::TryReadBuildingStylesProperty(
 		// in the Occupant Groups property.
 
 		if (std::find_if_not(
-			temp.begin(),
-			temp.end(),
-			IsStyleIDReservedOrNotInUI) != temp.end())
+			buildingStyles.begin(),
+			buildingStyles.end(),
+			IsStyleIDReservedOrNotInUI) != buildingStyles.end())
 		{
 			// Some versions of PIMX accidentally used the community style id 0x2004
 			// as a placeholder in the Building Styles property, fall back to the
 			// Maxis styles in that case.
-			if (!IsPIMXStyle2004Placeholder(pPropertyHolder, temp))
+			if (IsPIMXStyle2004Placeholder(pPropertyHolder, buildingStyles))
+			{
+				properties.usesPIMXPlaceholderFallback = true;
+			}
+			else
 			{
-				output = std::move(temp);
-				result = true;
+				properties.buildingStyles = buildingStyles;
+				properties.hasBuildingStylesProperty = true;
 			}
 		}
 	}
 
-	return result;
+	return properties;
 }
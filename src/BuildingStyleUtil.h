@@ -21,7 +21,8 @@
 
 #pragma once
 #include <cstdint>
-#include "PropertyData.h"
+#include <span>
+#include "PropertyView.h"
 
 namespace BuildingStyleUtil
 {
@@ -29,11 +30,32 @@ namespace BuildingStyleUtil
 	bool IsReservedStyleID(uint32_t style);
 	bool IsStyleIDReservedOrNotInUI(uint32_t style);
 
-	// Attempts to read the building styles property.
-	// Returns true if the property is present and contains
-	// at least one non-reserved style id that is also present
-	// in the Building Style Control UI.
-	bool TryReadBuildingStylesProperty(
-		cISCPropertyHolder* pPropertyHolder,
-		PropertyData<uint32_t>& output);
+	// The style information that is read from a building exemplar.
+	// The property views are only valid while the property holder is alive.
+	struct BuildingStyleProperties
+	{
+		// The Building Styles property values, this is empty when the property
+		// is not present or does not contain a usable style.
+		PropertyView<uint32_t> buildingStyles;
+		PropertyView<uint32_t> occupantGroups;
+		// The industry type occupant group (0x3000-0x3002), or 0 if the building doesn't have one.
+		uint32_t industryOccupantGroup;
+		bool hasBuildingStylesProperty;
+		// The Building Styles property contains the PIM-X 0x2004 placeholder, the
+		// building uses the Maxis styles in its Occupant Groups instead.
+		bool usesPIMXPlaceholderFallback;
+		bool isWallToWall;
+
+		BuildingStyleProperties();
+
+		// Gets the building's styles, the Maxis styles in the Occupant Groups are
+		// used when the building does not have a usable Building Styles property.
+		std::span<const uint32_t> GetStyles() const;
+	};
+
+	// Reads the style information from a building exemplar.
+	// Each property is looked up at most once, the Building Styles property is
+	// only used if it contains at least one non-reserved style id that is also
+	// present in the Building Style Control UI.
+	BuildingStyleProperties ReadBuildingStyleProperties(cISCPropertyHolder* pPropertyHolder);
 }
\ No newline at end of file
@@ -21,13 +21,33 @@
 
 #include "BuildingUtil.h"
 #include "cIGZVariant.h"
+#include "cISC4BuildingDevelopmentSimulator.h"
 #include "cISC4BuildingOccupant.h"
 #include "cISC4Occupant.h"
 #include "cISCProperty.h"
 #include "cISCPropertyHolder.h"
 #include "cRZAutoRefCount.h"
+#include "OccupantGroupClassifier.h"
 #include "PropertyIDs.h"
-#include "WallToWallOccupantGroups.h"
+
+std::vector<uint32_t> BuildingUtil::GetAllBuildingTypes(cISC4BuildingDevelopmentSimulator& buildingDevelopmentSim)
+{
+	uint32_t dummy = 0;
+
+	// GetAllBuildingTypes doesn't follow the pattern in many other SC4 APIs of
+	// returning the size in the count field when the data pointer is NULL, instead
+	// it only uses the return value.
+
+	const uint32_t count = buildingDevelopmentSim.GetAllBuildingTypes(nullptr, dummy);
+
+	std::vector<uint32_t> buildingTypes(count);
+
+	uint32_t vectorSize = count;
+
+	buildingDevelopmentSim.GetAllBuildingTypes(buildingTypes.data(), vectorSize);
+
+	return buildingTypes;
+}
 
 cISC4BuildingOccupant::PurposeType BuildingUtil::GetPurposeType(cISC4Occupant* pOccupant)
 {
@@ -74,16 +94,16 @@ bool BuildingUtil::IsIndustrialBuilding(cISC4BuildingOccupant::PurposeType purpo
 		&& purposeType <= cISC4BuildingOccupant::PurposeType::HighTech;
 }
 
-bool BuildingUtil::IsWallToWall(const cISCPropertyHolder* pPropertyHolder)
+namespace
 {
-	bool buildingIsWallToWall = false;
-
-	if (pPropertyHolder)
+	bool TryGetWallToWallPropertyValue(const cISCProperty* pProperty, bool& buildingIsWallToWall)
 	{
-		const cISCProperty* pProperty = pPropertyHolder->GetProperty(kBuildingIsWallToWallProperty);
+		bool result = false;
 
 		if (pProperty)
 		{
+			result = true;
+
 			const cIGZVariant* pVariant = pProperty->GetPropertyValue();
 
 			if (pVariant)
@@ -105,7 +125,20 @@ bool BuildingUtil::IsWallToWall(const cISCPropertyHolder* pPropertyHolder)
 				}
 			}
 		}
-		else
+
+		return result;
+	}
+}
+
+bool BuildingUtil::IsWallToWall(const cISCPropertyHolder* pPropertyHolder)
+{
+	bool buildingIsWallToWall = false;
+
+	if (pPropertyHolder)
+	{
+		if (!TryGetWallToWallPropertyValue(
+			pPropertyHolder->GetProperty(kBuildingIsWallToWallProperty),
+			buildingIsWallToWall))
 		{
 			const cISCProperty* pProperty = pPropertyHolder->GetProperty(kOccupantGroupsProperty);
 
@@ -115,19 +148,10 @@ bool BuildingUtil::IsWallToWall(const cISCPropertyHolder* pPropertyHolder)
 
 				if (pVariant)
 				{
-					const uint32_t* pData = pVariant->RefUint32();
-					const uint32_t count = pVariant->GetCount();
+					const uint8_t flags = OccupantGroupClassifier::ClassifyAll(
+						std::span<const uint32_t>(pVariant->RefUint32(), pVariant->GetCount()));
 
-					for (uint32_t i = 0; i < count; i++)
-					{
-						const uint32_t occupantGroup = pData[i];
-
-						if (WallToWallOccupantGroups.count(occupantGroup) != 0)
-						{
-							buildingIsWallToWall = true;
-							break;
-						}
-					}
+					buildingIsWallToWall = (flags & OccupantGroupClassifier::WallToWall) != 0;
 				}
 			}
 		}
@@ -136,6 +160,25 @@ bool BuildingUtil::IsWallToWall(const cISCPropertyHolder* pPropertyHolder)
 	return buildingIsWallToWall;
 }
 
+bool BuildingUtil::IsWallToWall(
+	const cISCPropertyHolder* pPropertyHolder,
+	bool hasWallToWallOccupantGroup)
+{
+	bool buildingIsWallToWall = false;
+
+	if (pPropertyHolder)
+	{
+		if (!TryGetWallToWallPropertyValue(
+			pPropertyHolder->GetProperty(kBuildingIsWallToWallProperty),
+			buildingIsWallToWall))
+		{
+			buildingIsWallToWall = hasWallToWallOccupantGroup;
+		}
+	}
+
+	return buildingIsWallToWall;
+}
+
 bool BuildingUtil::IsWallToWall(cISC4Occupant* pOccupant)
 {
 	bool result = false;
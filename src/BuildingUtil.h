@@ -21,12 +21,16 @@
 
 #pragma once
 #include "cISC4BuildingOccupant.h"
+#include <vector>
 
+class cISC4BuildingDevelopmentSimulator;
 class cISC4Occupant;
 class cISCPropertyHolder;
 
 namespace BuildingUtil
 {
+	std::vector<uint32_t> GetAllBuildingTypes(cISC4BuildingDevelopmentSimulator& buildingDevelopmentSim);
+
 	cISC4BuildingOccupant::PurposeType GetPurposeType(cISC4Occupant* pOccupant);
 
 	bool PurposeTypeSupportsBuildingStyles(cISC4BuildingOccupant::PurposeType purposeType);
@@ -34,5 +38,9 @@ namespace BuildingUtil
 	bool IsIndustrialBuilding(cISC4BuildingOccupant::PurposeType purposeType);
 
 	bool IsWallToWall(const cISCPropertyHolder* pPropertyHolder);
+	// Checks the Wall-to-Wall property, falling back to the caller's classification of
+	// the Occupant Groups when the property is not present.
+	// This avoids a second Occupant Groups property lookup.
+	bool IsWallToWall(const cISCPropertyHolder* pPropertyHolder, bool hasWallToWallOccupantGroup);
 	bool IsWallToWall(cISC4Occupant* pOccupant);
 }
\ No newline at end of file
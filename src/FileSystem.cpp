@@ -59,3 +59,11 @@ std::filesystem::path FileSystem::GetConfigFilePath()
 
 	return path;
 }
+
+std::filesystem::path FileSystem::GetStyleSelectionTraceFilePath()
+{
+	std::filesystem::path path = GetDllFolderPath();
+	path /= L"SC4MoreBuildingStyles-StyleSelection.trace"sv;
+
+	return path;
+}
@@ -26,5 +26,6 @@ namespace FileSystem
 {
 	std::filesystem::path GetBuildingStylesIniFilePath();
 	std::filesystem::path GetConfigFilePath();
+	std::filesystem::path GetStyleSelectionTraceFilePath();
 };
 
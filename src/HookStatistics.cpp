@@ -0,0 +1,95 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HookStatistics.h"
+#include <algorithm>
+#include <bit>
+#include <intrin.h>
+
+HookStatistics::HookStatistics(const char* const name)
+	: name(name),
+	  callCount(0),
+	  totalTicks(0),
+	  maxTicks(0),
+	  buckets{}
+{
+}
+
+const char* HookStatistics::GetName() const
+{
+	return name;
+}
+
+uint64_t HookStatistics::GetCallCount() const
+{
+	return callCount;
+}
+
+uint64_t HookStatistics::GetTotalTicks() const
+{
+	return totalTicks;
+}
+
+uint64_t HookStatistics::GetMaxTicks() const
+{
+	return maxTicks;
+}
+
+const std::array<uint64_t, HookStatistics::BucketCount>& HookStatistics::GetBuckets() const
+{
+	return buckets;
+}
+
+void HookStatistics::Record(uint64_t elapsedTicks)
+{
+	// The bit width of the elapsed ticks is the floor of its base 2 logarithm plus one,
+	// anything that does not fit in the last bucket is added to it.
+	const size_t bucket = std::min(static_cast<size_t>(std::bit_width(elapsedTicks)), BucketCount - 1);
+
+	callCount++;
+	totalTicks += elapsedTicks;
+	maxTicks = std::max(maxTicks, elapsedTicks);
+	buckets[bucket]++;
+}
+
+void HookStatistics::Reset()
+{
+	callCount = 0;
+	totalTicks = 0;
+	maxTicks = 0;
+	buckets.fill(0);
+}
+
+uint64_t HookStatistics::GetTimestamp()
+{
+	return __rdtsc();
+}
+
+HookStatisticsTimer::HookStatisticsTimer(HookStatistics& statistics)
+	: statistics(statistics),
+	  startTimestamp(HookStatistics::GetTimestamp())
+{
+}
+
+HookStatisticsTimer::~HookStatisticsTimer()
+{
+	statistics.Record(HookStatistics::GetTimestamp() - startTimestamp);
+}
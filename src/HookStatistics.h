@@ -0,0 +1,71 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Records the call count and a latency histogram for a hooked game function.
+//
+// The latency is measured in CPU timestamp counter ticks, the histogram uses
+// power of two buckets: bucket 0 holds the calls that took 0 ticks and bucket N
+// holds the calls that took between 2^(N-1) and (2^N)-1 ticks.
+class HookStatistics
+{
+public:
+	static constexpr size_t BucketCount = 32;
+
+	explicit HookStatistics(const char* const name);
+
+	const char* GetName() const;
+	uint64_t GetCallCount() const;
+	uint64_t GetTotalTicks() const;
+	uint64_t GetMaxTicks() const;
+	const std::array<uint64_t, BucketCount>& GetBuckets() const;
+
+	void Record(uint64_t elapsedTicks);
+	void Reset();
+
+	static uint64_t GetTimestamp();
+
+private:
+	const char* const name;
+	uint64_t callCount;
+	uint64_t totalTicks;
+	uint64_t maxTicks;
+	std::array<uint64_t, BucketCount> buckets;
+};
+
+// Records the time between its construction and destruction in the specified HookStatistics.
+class HookStatisticsTimer
+{
+public:
+	explicit HookStatisticsTimer(HookStatistics& statistics);
+	~HookStatisticsTimer();
+
+	HookStatisticsTimer(const HookStatisticsTimer&) = delete;
+	HookStatisticsTimer& operator=(const HookStatisticsTimer&) = delete;
+
+private:
+	HookStatistics& statistics;
+	const uint64_t startTimestamp;
+};
@@ -20,7 +20,10 @@
  */
 
 #pragma once
+#include "BuildingStyleCatalog.h"
 #include "BuildingStyleCollection.h"
+#include "BuildingStyleIndex.h"
+#include "BuildingStylePostingLists.h"
 #include "cISC4TractDeveloper.h"
 #include "IBuildingSelectWinContext.h"
 
@@ -33,6 +36,9 @@ public:
 
 	virtual bool IsStyleButtonIDValid(uint32_t buttonID) const = 0;
 	virtual const BuildingStyleCollection& GetAvailableBuildingStyles() const = 0;
+	virtual const BuildingStyleCatalog& GetBuildingStyleCatalog() const = 0;
+	virtual const BuildingStylePostingLists& GetBuildingStylePostingLists() const = 0;
+	virtual const BuildingStyleIndex& GetBuildingStyleIndex() const = 0;
 
 	virtual IBuildingSelectWinContext& GetContext() = 0;
 	virtual const IBuildingSelectWinContext& GetContext() const = 0;
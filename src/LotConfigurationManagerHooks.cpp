@@ -20,7 +20,6 @@
  */
 
 #include "LotConfigurationManagerHooks.h"
-#include "BuildingUtil.h"
 #include "BuildingStyleUtil.h"
 #include "cGZPersistResourceKey.h"
 #include "cIGZPersistResourceManager.h"
@@ -28,104 +27,102 @@
 #include "cISCProperty.h"
 #include "cISCPropertyHolder.h"
 #include "cRZAutoRefCount.h"
+#include "cSC4LotConfiguration.h"
 #include "GZServPtrs.h"
 #include "Logger.h"
+#include "LotConfigurationStyleIndex.h"
 #include "Patcher.h"
-#include "PropertyData.h"
-#include "PropertyIDs.h"
+#include "Preferences.h"
 #include "SC4Vector.h"
 #include "SC4VersionDetection.h"
-#include "WallToWallOccupantGroups.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleSetTable.h"
 #include "wil/result.h"
 
-#include <algorithm>
-#include <functional>
-#include <iterator>
+#include <chrono>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
-static void CopyOccupantGroupValues(
-	cISCPropertyHolder* pPropertyHolder,
-	SC4Vector<uint32_t>& vector)
+namespace
 {
-	const PropertyData<uint32_t> propertyData(pPropertyHolder, kOccupantGroupsProperty);
-
-	if (propertyData)
+	struct BuildingExemplarKey
 	{
-		vector.push_back(propertyData.data(), propertyData.size());
-	}
-}
+		uint32_t type;
+		uint32_t group;
+		uint32_t instance;
 
-static void CopyIndustryTypeOccupantGroups(
-	cISCPropertyHolder* pPropertyHolder,
-	SC4Vector<uint32_t>& vector)
-{
-	const PropertyData<uint32_t> propertyData(pPropertyHolder, kOccupantGroupsProperty);
+		bool operator==(const BuildingExemplarKey& other) const = default;
+	};
 
-	if (propertyData)
+	struct BuildingExemplarKeyHash
 	{
-		constexpr uint32_t kIndustryAnchor = 0x3000;
-		constexpr uint32_t kIndustryOut = 0x3002;
-
-		const auto it = std::find_if(
-			propertyData.begin(),
-			propertyData.end(),
-			[](uint32_t value)
-			{
-				return value >= kIndustryAnchor && value <= kIndustryOut;
-			});
-
-		if (it != propertyData.end())
+		size_t operator()(const BuildingExemplarKey& key) const noexcept
 		{
-			vector.push_back(*it);
+			return std::hash<uint64_t>{}((static_cast<uint64_t>(key.group) << 32) | key.instance) ^ key.type;
 		}
-	}
+	};
+
+	struct InitializationStatistics
+	{
+		uint32_t callCount = 0;
+		uint32_t parsedExemplarCount = 0;
+		std::chrono::steady_clock::duration parseTime{};
+		std::chrono::steady_clock::duration totalTime{};
+		bool written = false;
+	};
 }
 
-static bool ReadBuildingStylePropertyValues(
-	cISCPropertyHolder* pPropertyHolder,
+static LotConfigurationStyleIndex lotConfigurationStyleIndex;
+// Many lot configurations use the same building exemplar, the values that were read from
+// each exemplar are kept for the rest of the session because the game does not reload them.
+// The DisableBuildingExemplarStyleCache option turns the cache off to measure its effect on the load time.
+static StyleSetTable buildingExemplarStyleSets;
+static std::unordered_map<BuildingExemplarKey, uint32_t, BuildingExemplarKeyHash> buildingExemplarStyleSetIDs;
+static bool buildingExemplarStyleCacheEnabled = true;
+static InitializationStatistics initializationStatistics;
+static bool cityShutdownSinceLastCall = false;
+
+static void CopyBuildingStyleValues(
+	const BuildingStyleUtil::BuildingStyleProperties& properties,
 	SC4Vector<uint32_t>& vector)
 {
-	vector.clear();
+	if (properties.hasBuildingStylesProperty)
+	{
+		const std::vector<uint32_t> values = StyleCompatibilityEngine::GetLotConfigurationStyleValues(
+			properties.buildingStyles.values(),
+			properties.isWallToWall,
+			properties.occupantGroups.values());
 
-	PropertyData<uint32_t> propertyData;
+		if (!values.empty())
+		{
+			vector.push_back(values.data(), values.size());
+			return;
+		}
+	}
 
-	if (BuildingStyleUtil::TryReadBuildingStylesProperty(pPropertyHolder, propertyData))
+	if (properties.occupantGroups)
 	{
-		std::copy(
-			propertyData.begin(),
-			propertyData.end(),
-			std::back_inserter(vector));
+		vector.push_back(properties.occupantGroups.data(), properties.occupantGroups.size());
 	}
-
-	return !vector.empty();
 }
 
-static bool ReadBuildingStyleProperty(
-	cISCPropertyHolder* pPropertyHolder,
-	SC4Vector<uint32_t>& vector)
+static bool ReadBuildingExemplarStyles(cGZPersistResourceKey const& key, SC4Vector<uint32_t>& vector)
 {
 	bool result = false;
 
-	if (ReadBuildingStylePropertyValues(pPropertyHolder, vector))
+	cIGZPersistResourceManagerPtr pRM;
+
+	if (pRM)
 	{
-		// Add the BuildingStyles property id to indicate that the property is present.
-		vector.push_back(kBuildingStylesProperty);
+		cRZAutoRefCount<cISCPropertyHolder> pPropertyHolder;
 
-		// Copy over the wall-to-wall (W2W) data, if present.
-		if (BuildingUtil::IsWallToWall(pPropertyHolder))
+		if (pRM->GetResource(key, GZIID_cISCPropertyHolder, pPropertyHolder.AsPPVoid(), 0, nullptr))
 		{
-			// The exact W2W style doesn't matter, only the fact
-			// that it is present in the occupant groups.
+			CopyBuildingStyleValues(BuildingStyleUtil::ReadBuildingStyleProperties(pPropertyHolder), vector);
 
-			constexpr uint32_t W2WGeneral = 0xB5C00DDE;
-
-			vector.push_back(W2WGeneral);
+			result = true;
 		}
-
-		// Copy over the industry type occupant groups.
-		// This is checked for industrial buildings in cSC4TractDeveloper::PickBuilding.
-		CopyIndustryTypeOccupantGroups(pPropertyHolder, vector);
-
-		result = true;
 	}
 
 	return result;
@@ -137,28 +134,103 @@ static void __cdecl GetBuildingStyles(cGZPersistResourceKey const& key, SC4Vecto
 	// The lot configuration class uses this information allow callers to check if any of the
 	// lot's possible buildings have a specific building style.
 
+	const auto startTime = std::chrono::steady_clock::now();
+
+	if (cityShutdownSinceLastCall)
+	{
+		// The lot configuration manager is being initialized for a new city, the
+		// lot configurations from the previous city no longer exist.
+		lotConfigurationStyleIndex.ClearLotConfigurations();
+		initializationStatistics = InitializationStatistics();
+		cityShutdownSinceLastCall = false;
+	}
+
 	vector.clear();
 
-	cIGZPersistResourceManagerPtr pRM;
+	const BuildingExemplarKey exemplarKey{ key.type, key.group, key.instance };
+	const auto it = buildingExemplarStyleCacheEnabled
+		? buildingExemplarStyleSetIDs.find(exemplarKey)
+		: buildingExemplarStyleSetIDs.end();
 
-	if (pRM)
+	if (it != buildingExemplarStyleSetIDs.end())
 	{
-		cRZAutoRefCount<cISCPropertyHolder> pPropertyHolder;
+		const std::span<const uint32_t> values = buildingExemplarStyleSets.get(it->second);
 
-		if (pRM->GetResource(key, GZIID_cISCPropertyHolder, pPropertyHolder.AsPPVoid(), 0, nullptr))
+		if (!values.empty())
+		{
+			vector.push_back(values.data(), values.size());
+		}
+	}
+	else
+	{
+		if (ReadBuildingExemplarStyles(key, vector) && buildingExemplarStyleCacheEnabled)
 		{
-			if (!ReadBuildingStyleProperty(pPropertyHolder, vector))
-			{
-				CopyOccupantGroupValues(pPropertyHolder, vector);
-			}
+			buildingExemplarStyleSetIDs.emplace(
+				exemplarKey,
+				buildingExemplarStyleSets.intern(std::span<const uint32_t>(vector.begin(), vector.size())));
 		}
+
+		initializationStatistics.parsedExemplarCount++;
+		initializationStatistics.parseTime += std::chrono::steady_clock::now() - startTime;
+	}
+
+	lotConfigurationStyleIndex.Add(&vector, std::span<const uint32_t>(vector.begin(), vector.size()));
+
+	initializationStatistics.callCount++;
+	initializationStatistics.totalTime += std::chrono::steady_clock::now() - startTime;
+}
+
+LotConfigurationStyleIndex& LotConfigurationManagerHooks::GetLotConfigurationStyleIndex()
+{
+	return lotConfigurationStyleIndex;
+}
+
+uint32_t LotConfigurationManagerHooks::GetLotConfigurationID(const void* lotConfigurationKey)
+{
+	const cSC4LotConfiguration* pLotConfiguration = reinterpret_cast<const cSC4LotConfiguration*>(
+		static_cast<const uint8_t*>(lotConfigurationKey) - offsetof(cSC4LotConfiguration, buildingOccupantGroups));
+
+	return pLotConfiguration->id;
+}
+
+void LotConfigurationManagerHooks::PostCityShutdown()
+{
+	cityShutdownSinceLastCall = true;
+}
+
+void LotConfigurationManagerHooks::WriteInitializationStatistics()
+{
+	if (initializationStatistics.written || initializationStatistics.callCount == 0)
+	{
+		return;
 	}
+
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+
+	const InitializationStatistics& stats = initializationStatistics;
+	const double totalMs = std::chrono::duration_cast<Milliseconds>(stats.totalTime).count();
+	const double parseMs = std::chrono::duration_cast<Milliseconds>(stats.parseTime).count();
+	const uint32_t cacheHitCount = stats.callCount - stats.parsedExemplarCount;
+
+	Logger::GetInstance().WriteLineFormatted(
+		LogLevel::Info,
+		"Building exemplar style cache (%s): %u calls, %u cache hits, %u exemplars parsed (%.1f ms), %.1f ms total.",
+		buildingExemplarStyleCacheEnabled ? "enabled" : "disabled",
+		stats.callCount,
+		cacheHitCount,
+		stats.parsedExemplarCount,
+		parseMs,
+		totalMs);
+
+	initializationStatistics.written = true;
 }
 
-void LotConfigurationManagerHooks::Install()
+void LotConfigurationManagerHooks::Install(const Preferences& preferences)
 {
 	Logger& logger = Logger::GetInstance();
 
+	buildingExemplarStyleCacheEnabled = !preferences.DisableBuildingExemplarStyleCache();
+
 	uintptr_t InitBuildingInformation_Inject = 0;
 
 	const uint16_t gameVersion = SC4VersionDetection::GetGameVersion();
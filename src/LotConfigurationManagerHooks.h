@@ -20,8 +20,30 @@
  */
 
 #pragma once
+#include <cstdint>
+
+class LotConfigurationStyleIndex;
+class Preferences;
 
 namespace LotConfigurationManagerHooks
 {
-	void Install();
+	// Gets the style index that is built from the values the GetBuildingStyles
+	// hook copies into each lot configuration.
+	LotConfigurationStyleIndex& GetLotConfigurationStyleIndex();
+
+	// Gets the id of the lot configuration that owns the occupant group vector
+	// that is used as its key in the style index.
+	uint32_t GetLotConfigurationID(const void* lotConfigurationKey);
+
+	// The lot configuration manager may be initialized again when the next city is loaded,
+	// so the lot configurations are removed from the style index on its first hook call.
+	void PostCityShutdown();
+
+	// Writes the call count, building exemplar cache hits and elapsed time of the
+	// GetBuildingStyles hook for the last lot configuration manager initialization to the log.
+	// The log line states whether the building exemplar style cache was enabled, so the
+	// times can be compared with the DisableBuildingExemplarStyleCache option.
+	void WriteInitializationStatistics();
+
+	void Install(const Preferences& preferences);
 }
\ No newline at end of file
@@ -0,0 +1,272 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LotConfigurationStyleIndex.h"
+#include "BuildingStyleIndex.h"
+#include "PropertyIDs.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleListSearch.h"
+#include <algorithm>
+
+LotConfigurationStyleIndex::LotConfigurationStyleIndex()
+	: styleMaskWordCount(0),
+	  styleMaskCount(0),
+	  activeStylesValid(false),
+	  rejectedCount(0),
+	  lotConfigurationGeneration(0),
+	  invertedIndexDirty(false)
+{
+}
+
+void LotConfigurationStyleIndex::Add(const void* lotConfigurationKey, std::span<const uint32_t> values)
+{
+	// The game may call the GetBuildingStyles hook more than once for the same lot
+	// configuration, each call clears the vector before filling it.
+	const uint32_t styleSetID = styleSets.intern(values);
+
+	if (styleSetID == styleSetMetadata.size())
+	{
+		styleSetMetadata.push_back(CreateStyleSetMetadata(values));
+	}
+
+	lotConfigurationStyleSets.insert_or_assign(lotConfigurationKey, styleSetID);
+	lotConfigurationGeneration++;
+	invertedIndexDirty = true;
+	activeStylesValid = false;
+}
+
+void LotConfigurationStyleIndex::ClearLotConfigurations()
+{
+	lotConfigurationStyleSets.clear();
+	lotConfigurationGeneration++;
+	invertedIndexDirty = true;
+	activeStylesValid = false;
+}
+
+void LotConfigurationStyleIndex::SetActiveStyles(std::span<const uint32_t> activeStyles)
+{
+	if (invertedIndexDirty)
+	{
+		BuildInvertedIndex();
+	}
+
+	styleSetActiveStyleCounts.assign(styleSets.size(), 0);
+
+	for (const uint32_t style : activeStyles)
+	{
+		for (const uint32_t styleSetID : GetStyleSetsWithValue(style))
+		{
+			styleSetActiveStyleCounts[styleSetID]++;
+		}
+	}
+
+	activeStylesValid = true;
+}
+
+bool LotConfigurationStyleIndex::UpdateActiveStyle(uint32_t style, bool isActive)
+{
+	if (!activeStylesValid)
+	{
+		return false;
+	}
+
+	for (const uint32_t styleSetID : GetStyleSetsWithValue(style))
+	{
+		uint32_t& count = styleSetActiveStyleCounts[styleSetID];
+
+		if (isActive)
+		{
+			count++;
+		}
+		else if (count > 0)
+		{
+			count--;
+		}
+	}
+
+	return true;
+}
+
+std::span<const void* const> LotConfigurationStyleIndex::GetLotConfigurationsWithValue(uint32_t value)
+{
+	if (invertedIndexDirty)
+	{
+		BuildInvertedIndex();
+	}
+
+	const auto it = lotConfigurationsByValue.find(value);
+
+	return it != lotConfigurationsByValue.end() ? it->second : std::span<const void* const>();
+}
+
+std::span<const uint32_t> LotConfigurationStyleIndex::GetStyleSetsWithValue(uint32_t value)
+{
+	if (invertedIndexDirty)
+	{
+		BuildInvertedIndex();
+	}
+
+	const auto it = styleSetsByValue.find(value);
+
+	return it != styleSetsByValue.end() ? it->second : std::span<const uint32_t>();
+}
+
+std::optional<uint32_t> LotConfigurationStyleIndex::GetStyleSetID(const void* lotConfigurationKey) const
+{
+	std::optional<uint32_t> result;
+
+	const auto it = lotConfigurationStyleSets.find(lotConfigurationKey);
+
+	if (it != lotConfigurationStyleSets.end())
+	{
+		result = it->second;
+	}
+
+	return result;
+}
+
+const StyleSetTable& LotConfigurationStyleIndex::GetStyleSets() const
+{
+	return styleSets;
+}
+
+const LotConfigurationStyleIndex::StyleSetMetadata& LotConfigurationStyleIndex::GetStyleSetMetadata(uint32_t styleSetID) const
+{
+	return styleSetMetadata[styleSetID];
+}
+
+void LotConfigurationStyleIndex::UpdateStyleMasks(const BuildingStyleIndex& styleIndex)
+{
+	if (!styleIndex.IsInitialized() || styleMaskCount == styleSets.size())
+	{
+		return;
+	}
+
+	// The style index does not change after it is initialized, so the
+	// existing masks are kept and only the new style sets are added.
+	styleMaskWordCount = StyleMask::GetWordCount(styleIndex.GetStyleIndexCount());
+	styleMaskPool.resize(styleSets.size() * styleMaskWordCount);
+
+	for (uint32_t styleSetID = styleMaskCount; styleSetID < styleSets.size(); styleSetID++)
+	{
+		const std::span<StyleMask::word_type> styleMask(
+			styleMaskPool.data() + (styleSetID * styleMaskWordCount),
+			styleMaskWordCount);
+
+		for (const uint32_t value : styleSets.get(styleSetID))
+		{
+			const std::optional<uint32_t> index = styleIndex.GetStyleIndex(value);
+
+			if (index.has_value())
+			{
+				StyleMask::SetBit(styleMask, index.value());
+			}
+		}
+	}
+
+	styleMaskCount = static_cast<uint32_t>(styleSets.size());
+}
+
+std::optional<std::span<const StyleMask::word_type>> LotConfigurationStyleIndex::GetStyleMask(uint32_t styleSetID) const
+{
+	std::optional<std::span<const StyleMask::word_type>> result;
+
+	if (styleSetID < styleMaskCount)
+	{
+		result = std::span<const StyleMask::word_type>(
+			styleMaskPool.data() + (styleSetID * styleMaskWordCount),
+			styleMaskWordCount);
+	}
+
+	return result;
+}
+
+bool LotConfigurationStyleIndex::MayContainActiveStyle(uint32_t styleSetID) const
+{
+	if (!activeStylesValid || styleSetActiveStyleCounts[styleSetID] != 0)
+	{
+		return true;
+	}
+
+	rejectedCount++;
+	return false;
+}
+
+uint64_t LotConfigurationStyleIndex::GetRejectedCount() const
+{
+	return rejectedCount;
+}
+
+uint32_t LotConfigurationStyleIndex::GetLotConfigurationGeneration() const
+{
+	return lotConfigurationGeneration;
+}
+
+LotConfigurationStyleIndex::StyleSetMetadata LotConfigurationStyleIndex::CreateStyleSetMetadata(std::span<const uint32_t> values)
+{
+	StyleSetMetadata metadata{};
+	metadata.industryOccupantGroup = StyleCompatibilityEngine::GetIndustryTypeOccupantGroup(values);
+	metadata.hasBuildingStylesProperty = StyleListSearch::Contains(values, kBuildingStylesProperty);
+	metadata.isWallToWall = StyleCompatibilityEngine::HasWallToWallOccupantGroup(values);
+
+	return metadata;
+}
+
+void LotConfigurationStyleIndex::BuildInvertedIndex()
+{
+	lotConfigurationsByValue.clear();
+	styleSetsByValue.clear();
+	activeStylesValid = false;
+
+	for (uint32_t styleSetID = 0; styleSetID < styleSets.size(); styleSetID++)
+	{
+		for (const uint32_t value : styleSets.get(styleSetID))
+		{
+			std::vector<uint32_t>& styleSetIDs = styleSetsByValue[value];
+
+			// A style set can contain the same value more than once.
+			if (styleSetIDs.empty() || styleSetIDs.back() != styleSetID)
+			{
+				styleSetIDs.push_back(styleSetID);
+			}
+		}
+	}
+
+	for (const auto& [lotConfigurationKey, styleSetID] : lotConfigurationStyleSets)
+	{
+		for (const uint32_t value : styleSets.get(styleSetID))
+		{
+			std::vector<const void*>& lotConfigurations = lotConfigurationsByValue[value];
+
+			if (lotConfigurations.empty() || lotConfigurations.back() != lotConfigurationKey)
+			{
+				lotConfigurations.push_back(lotConfigurationKey);
+			}
+		}
+	}
+
+	for (auto& [value, lotConfigurations] : lotConfigurationsByValue)
+	{
+		std::sort(lotConfigurations.begin(), lotConfigurations.end());
+	}
+
+	invertedIndexDirty = false;
+}
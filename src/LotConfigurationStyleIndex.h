@@ -0,0 +1,130 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "StyleMask.h"
+#include "StyleSetTable.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class BuildingStyleIndex;
+
+// An inverted index from the style and occupant group values that the
+// GetBuildingStyles hook copies into each lot configuration to the lot configurations
+// that contain them.
+//
+// The game does not pass the lot configuration to the GetBuildingStyles hook, so the
+// lot configurations are identified by the address of their occupant group vector.
+// This address is stable for the lifetime of the lot configuration manager.
+//
+// Many lot configurations share the same values, so each distinct list of values is
+// interned in a StyleSetTable and the lot configurations are mapped to its set id.
+//
+// The marker values that the hook adds after a building's styles are decoded once
+// per style set, so the lot-level checks can use the set's metadata instead of
+// scanning the occupant groups.
+class LotConfigurationStyleIndex
+{
+public:
+	struct StyleSetMetadata
+	{
+		// The industry type occupant group (0x3000-0x3002), or 0 if the set doesn't have one.
+		uint32_t industryOccupantGroup;
+		bool hasBuildingStylesProperty;
+		bool isWallToWall;
+	};
+
+	LotConfigurationStyleIndex();
+
+	// Records the values that the GetBuildingStyles hook copied into a lot
+	// configuration's occupant group vector, replacing any previous values.
+	void Add(const void* lotConfigurationKey, std::span<const uint32_t> values);
+
+	// Removes the lot configurations, the interned style sets are kept so that
+	// their ids remain valid for the callers that cache results by set id.
+	void ClearLotConfigurations();
+
+	// Marks the style sets that contain at least one of the active styles.
+	void SetActiveStyles(std::span<const uint32_t> activeStyles);
+
+	// Updates the style sets that contain a single style that was added to or removed
+	// from the active styles after the last SetActiveStyles call.
+	// Returns false if SetActiveStyles must be called to rebuild the active style flags.
+	bool UpdateActiveStyle(uint32_t style, bool isActive);
+
+	// Gets a list of the lot configurations that contain the specified value,
+	// the list is sorted by the lot configuration key.
+	std::span<const void* const> GetLotConfigurationsWithValue(uint32_t value);
+
+	// Gets a sorted list of the ids of the style sets that contain the specified value.
+	std::span<const uint32_t> GetStyleSetsWithValue(uint32_t value);
+
+	// Gets the id of the lot configuration's style set, this has no value if the
+	// lot configuration was not seen by the GetBuildingStyles hook.
+	std::optional<uint32_t> GetStyleSetID(const void* lotConfigurationKey) const;
+
+	const StyleSetTable& GetStyleSets() const;
+
+	const StyleSetMetadata& GetStyleSetMetadata(uint32_t styleSetID) const;
+
+	// Builds the style masks for the style sets that were added since the last call.
+	// Nothing is built until the style index has been initialized for the first city.
+	void UpdateStyleMasks(const BuildingStyleIndex& styleIndex);
+
+	// Gets a StyleMask with the bits set for the indexed styles in the style set.
+	// This has no value if the set was added after the last UpdateStyleMasks call.
+	std::optional<std::span<const StyleMask::word_type>> GetStyleMask(uint32_t styleSetID) const;
+
+	// Returns false if the style set is known to not contain any of the active styles.
+	// Every style set returns true when the index changed after the last SetActiveStyles call.
+	bool MayContainActiveStyle(uint32_t styleSetID) const;
+
+	uint64_t GetRejectedCount() const;
+
+	// Gets a value that changes whenever a lot configuration is added or the lot
+	// configurations are cleared. Callers that copy the lot configuration lists use
+	// it to detect when their copy refers to lot configurations that no longer exist.
+	uint32_t GetLotConfigurationGeneration() const;
+
+private:
+	void BuildInvertedIndex();
+
+	static StyleSetMetadata CreateStyleSetMetadata(std::span<const uint32_t> values);
+
+	StyleSetTable styleSets;
+	std::vector<StyleSetMetadata> styleSetMetadata;
+	std::vector<StyleMask::word_type> styleMaskPool;
+	size_t styleMaskWordCount;
+	uint32_t styleMaskCount;
+	std::unordered_map<const void*, uint32_t> lotConfigurationStyleSets;
+	std::unordered_map<uint32_t, std::vector<const void*>> lotConfigurationsByValue;
+	std::unordered_map<uint32_t, std::vector<uint32_t>> styleSetsByValue;
+	// The number of active styles in each style set.
+	std::vector<uint32_t> styleSetActiveStyleCounts;
+	// Set when the active style flags were built from the current inverted index.
+	bool activeStylesValid;
+	mutable uint64_t rejectedCount;
+	uint32_t lotConfigurationGeneration;
+	bool invertedIndexDirty;
+};
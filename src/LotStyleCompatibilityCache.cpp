@@ -0,0 +1,132 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LotStyleCompatibilityCache.h"
+
+LotStyleCompatibilityCache::LotStyleCompatibilityCache()
+	: entries(),
+	  hitCount(0),
+	  missCount(0)
+{
+}
+
+std::optional<bool> LotStyleCompatibilityCache::find(
+	uint32_t key,
+	cISC4BuildingOccupant::PurposeType purpose,
+	uint32_t epoch)
+{
+	std::optional<bool> result;
+
+	const std::optional<size_t> slotIndex = GetSlotIndex(purpose);
+
+	if (slotIndex.has_value())
+	{
+		const auto it = entries.find(key);
+
+		if (it != entries.end())
+		{
+			const Slot& slot = it->second[slotIndex.value()];
+
+			if (slot.valid && slot.epoch == epoch)
+			{
+				result = slot.result;
+			}
+		}
+	}
+
+	if (result.has_value())
+	{
+		hitCount++;
+	}
+	else
+	{
+		missCount++;
+	}
+
+	return result;
+}
+
+void LotStyleCompatibilityCache::insert(
+	uint32_t key,
+	cISC4BuildingOccupant::PurposeType purpose,
+	uint32_t epoch,
+	bool result)
+{
+	const std::optional<size_t> slotIndex = GetSlotIndex(purpose);
+
+	if (slotIndex.has_value())
+	{
+		Slot& slot = entries[key][slotIndex.value()];
+
+		slot.epoch = epoch;
+		slot.valid = true;
+		slot.result = result;
+	}
+}
+
+void LotStyleCompatibilityCache::rebase(
+	uint32_t previousEpoch,
+	uint32_t newEpoch,
+	std::span<const uint32_t> invalidatedKeys)
+{
+	for (const uint32_t key : invalidatedKeys)
+	{
+		entries.erase(key);
+	}
+
+	for (auto& [key, entry] : entries)
+	{
+		for (Slot& slot : entry)
+		{
+			if (slot.valid && slot.epoch == previousEpoch)
+			{
+				slot.epoch = newEpoch;
+			}
+		}
+	}
+}
+
+void LotStyleCompatibilityCache::clear()
+{
+	entries.clear();
+}
+
+uint64_t LotStyleCompatibilityCache::GetHitCount() const
+{
+	return hitCount;
+}
+
+uint64_t LotStyleCompatibilityCache::GetMissCount() const
+{
+	return missCount;
+}
+
+std::optional<size_t> LotStyleCompatibilityCache::GetSlotIndex(cISC4BuildingOccupant::PurposeType purpose)
+{
+	const size_t index = static_cast<size_t>(purpose);
+
+	if (index < PurposeSlotCount)
+	{
+		return index;
+	}
+
+	return std::nullopt;
+}
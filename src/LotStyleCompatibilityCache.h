@@ -0,0 +1,81 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "cISC4BuildingOccupant.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+
+// Caches the result of the lot configuration style compatibility check.
+// Each result is tagged with the style selection epoch that was current when it
+// was computed, an epoch change invalidates all of the existing results.
+// The key is either a lot configuration id or a lot configuration style set id.
+//
+// Lots in mixed zones are checked for several purpose types in the same epoch,
+// so each key has a separate result slot for every purpose type.
+class LotStyleCompatibilityCache
+{
+public:
+	LotStyleCompatibilityCache();
+
+	std::optional<bool> find(
+		uint32_t key,
+		cISC4BuildingOccupant::PurposeType purpose,
+		uint32_t epoch);
+
+	void insert(
+		uint32_t key,
+		cISC4BuildingOccupant::PurposeType purpose,
+		uint32_t epoch,
+		bool result);
+
+	// Moves the results of the previous epoch to the new epoch and removes the
+	// results of the specified keys, this is used when a change to the style
+	// selection only affects a few of the keys.
+	void rebase(uint32_t previousEpoch, uint32_t newEpoch, std::span<const uint32_t> invalidatedKeys);
+
+	void clear();
+
+	uint64_t GetHitCount() const;
+	uint64_t GetMissCount() const;
+
+private:
+	struct Slot
+	{
+		uint32_t epoch = 0;
+		bool valid = false;
+		bool result = false;
+	};
+
+	// The growable purpose types range from Residence to HighTech.
+	static constexpr size_t PurposeSlotCount = static_cast<size_t>(cISC4BuildingOccupant::PurposeType::HighTech) + 1;
+
+	using Entry = std::array<Slot, PurposeSlotCount>;
+
+	static std::optional<size_t> GetSlotIndex(cISC4BuildingOccupant::PurposeType purpose);
+
+	std::unordered_map<uint32_t, Entry> entries;
+	uint64_t hitCount;
+	uint64_t missCount;
+};
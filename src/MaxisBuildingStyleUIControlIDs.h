@@ -20,8 +20,8 @@
  */
 
 #pragma once
+#include <array>
 #include <cstdint>
-#include "frozen/unordered_set.h"
 
 constexpr uint32_t StyleControlRadio_CycleEveryNYears = 0xCBC61559;
 constexpr uint32_t StyleControlRadio_UseAllStylesAtOnce = 0xEBC61560;
@@ -30,7 +30,7 @@ constexpr uint32_t StylePanel_Expanded_TitleBar = 0x2BC619F3;
 constexpr uint32_t StylePanel_Collapsed_ToggleButton = 0xCBC61567;
 constexpr uint32_t StylePanel_Expanded_ToggleButton = 0xEBC619FD;
 
-static constexpr frozen::unordered_set<uint32_t, 6> MaxisUIControlIDs =
+static constexpr std::array<uint32_t, 6> MaxisUIControlIDs =
 {
 	StyleControlRadio_CycleEveryNYears,
 	StyleControlRadio_UseAllStylesAtOnce,
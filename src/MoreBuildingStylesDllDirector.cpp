@@ -66,10 +66,14 @@ static constexpr uint32_t kMoreBuildingStylesDirectorID = 0x3BF9E52C;
 
 static constexpr std::string_view kDebugActiveStylesCheatName = "DebugActiveStyles";
 static constexpr std::string_view kActiveStyleCheatName = "ActiveStyle";
+static constexpr std::string_view kDebugStyleSelectionStatsCheatName = "DebugStyleSelectionStats";
+static constexpr std::string_view kDebugHookStatsCheatName = "DebugHookStats";
 static constexpr std::string_view kMaxisDebugRCIGrowthCheatName = "MaxisDebugRCIGrowth";
 static constexpr std::string_view kMaxisIgnoreRCIGrowthCapsCheatName = "MaxisIgnoreRCIGrowthCaps";
 static constexpr uint32_t kDebugActiveStylesCheatID = 0x730FF429;
 static constexpr uint32_t kActiveStyleCheatID = 0x4580A54D;
+static constexpr uint32_t kDebugStyleSelectionStatsCheatID = 0x6E1B2D47;
+static constexpr uint32_t kDebugHookStatsCheatID = 0x5A3C91E4;
 static constexpr uint32_t kMaxisDebugRCIGrowthCheatID = 0x7B01A355;
 static constexpr uint32_t kMaxisIgnoreRCIGrowthCapsCheatID = 0x7B01A356;
 
@@ -143,6 +147,11 @@ public:
 	{
 		pCity = static_cast<cISC4City*>(pStandardMsg->GetVoid1());
 
+		if (preferences.CollectHookStatistics())
+		{
+			LotConfigurationManagerHooks::WriteInitializationStatistics();
+		}
+
 		if (pCity)
 		{
 			cISC4AppPtr pSC4App;
@@ -160,6 +169,12 @@ public:
 					pCheatCodeManager->RegisterCheatCode(
 						kActiveStyleCheatID,
 						cRZBaseString(kActiveStyleCheatName.data(), kActiveStyleCheatName.size()));
+					pCheatCodeManager->RegisterCheatCode(
+						kDebugStyleSelectionStatsCheatID,
+						cRZBaseString(kDebugStyleSelectionStatsCheatName.data(), kDebugStyleSelectionStatsCheatName.size()));
+					pCheatCodeManager->RegisterCheatCode(
+						kDebugHookStatsCheatID,
+						cRZBaseString(kDebugHookStatsCheatName.data(), kDebugHookStatsCheatName.size()));
 
 					if (BuildingDevelopmentSimulatorHooks::IsSupportedGameVersion())
 					{
@@ -179,6 +194,14 @@ public:
 	{
 		pCity = nullptr;
 
+		if (preferences.LogCacheStatistics())
+		{
+			TractDeveloperHooks::WriteStyleSelectionStatistics();
+		}
+
+		TractDeveloperHooks::FlushStyleSelectionTrace();
+		LotConfigurationManagerHooks::PostCityShutdown();
+
 		cISC4AppPtr pSC4App;
 
 		if (pSC4App)
@@ -189,6 +212,8 @@ public:
 			{
 				pCheatCodeManager->UnregisterCheatCode(kDebugActiveStylesCheatID);
 				pCheatCodeManager->UnregisterCheatCode(kActiveStyleCheatID);
+				pCheatCodeManager->UnregisterCheatCode(kDebugStyleSelectionStatsCheatID);
+				pCheatCodeManager->UnregisterCheatCode(kDebugHookStatsCheatID);
 
 				if (BuildingDevelopmentSimulatorHooks::IsSupportedGameVersion())
 				{
@@ -223,6 +248,8 @@ public:
 					{
 						logger.WriteLineFormatted(LogLevel::Info, "0x%X", style);
 					}
+
+					TractDeveloperHooks::WriteBuildingCompatibilityTableStatus();
 				}
 			}
 		}
@@ -255,6 +282,14 @@ public:
 				}
 			}
 		}
+		else if (cheatID == kDebugStyleSelectionStatsCheatID)
+		{
+			TractDeveloperHooks::WriteStyleSelectionStatistics();
+		}
+		else if (cheatID == kDebugHookStatsCheatID)
+		{
+			TractDeveloperHooks::WriteHookStatistics();
+		}
 		else if (cheatID == kMaxisDebugRCIGrowthCheatID)
 		{
 			if (pCity)
@@ -307,7 +342,7 @@ public:
 
 		spBuildingSelectWinManager = &buildingSelectWinManager;
 		BuildingSelectWinProcHooks::Install();
-		LotConfigurationManagerHooks::Install();
+		LotConfigurationManagerHooks::Install(preferences);
 		TractDeveloperHooks::Install(preferences);
 		BuildingDevelopmentSimulatorHooks::Install();
 
@@ -339,6 +374,7 @@ public:
 
 	bool PreAppShutdown()
 	{
+		TractDeveloperHooks::Shutdown();
 		buildingSelectWinManager.Shutdown();
 
 		return true;
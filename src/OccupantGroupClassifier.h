@@ -0,0 +1,189 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "BuildingStyleButtons.h"
+#include "MaxisBuildingStyleUIControlIDs.h"
+#include "ReservedStyleIDs.h"
+#include "WallToWallOccupantGroupIDs.h"
+#include <array>
+#include <cstdint>
+#include <span>
+
+// Classifies occupant group and style id values with a single table probe.
+// The id headers used here only depend on the C++ standard library, so the classifier
+// can be used by the StyleCompatibilityEngine.
+//
+// The table is a perfect hash of the individual values in the Wall-to-Wall occupant
+// group, Maxis UI control id, optional button id and PIM-X placeholder lists, it is
+// generated from those lists at compile time. The value ranges are checked with
+// comparisons instead of the table.
+namespace OccupantGroupClassifier
+{
+	enum Flags : uint8_t
+	{
+		None = 0,
+		WallToWall = 1 << 0,
+		// The industry type occupant groups (0x3000-0x3002).
+		IndustryType = 1 << 1,
+		// The Maxis style ids (0x2000-0x2003).
+		MaxisStyle = 1 << 2,
+		MaxisUIControl = 1 << 3,
+		OptionalButton = 1 << 4,
+		ReservedButtonRange = 1 << 5,
+		PIMXPlaceholder = 1 << 6,
+		// The values that can't be used as a style id.
+		ReservedStyleID = MaxisUIControl | OptionalButton | ReservedButtonRange | PIMXPlaceholder,
+	};
+
+	namespace detail
+	{
+		constexpr uint32_t TableBits = 6;
+		constexpr size_t TableSize = size_t(1) << TableBits;
+
+		struct Entry
+		{
+			uint32_t value;
+			uint8_t flags;
+		};
+
+		struct Table
+		{
+			uint32_t multiplier;
+			std::array<Entry, TableSize> entries;
+		};
+
+		constexpr uint32_t GetSlot(uint32_t value, uint32_t multiplier)
+		{
+			return (value * multiplier) >> (32 - TableBits);
+		}
+
+		consteval Table BuildTable()
+		{
+			std::array<Entry, TableSize> values{};
+			size_t count = 0;
+
+			auto add = [&](uint32_t value, uint8_t flags)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					if (values[i].value == value)
+					{
+						values[i].flags |= flags;
+						return;
+					}
+				}
+
+				values[count++] = Entry{ value, flags };
+			};
+
+			for (const uint32_t value : WallToWallOccupantGroupIDs)
+			{
+				add(value, WallToWall);
+			}
+
+			for (const uint32_t value : MaxisUIControlIDs)
+			{
+				add(value, MaxisUIControl);
+			}
+
+			for (const uint32_t value : OptionalButtonIDs)
+			{
+				add(value, OptionalButton);
+			}
+
+			add(PIMXPlaceholderStyleID, PIMXPlaceholder);
+
+			// Search for a multiplier that maps every value to a different slot.
+			// The table is sparse enough that only a few multipliers are tried.
+			for (uint32_t multiplier = 0x9E3779B1; ; multiplier += 2)
+			{
+				Table table{ multiplier, {} };
+				std::array<bool, TableSize> used{};
+				bool collision = false;
+
+				for (size_t i = 0; i < count; i++)
+				{
+					const uint32_t slot = GetSlot(values[i].value, multiplier);
+
+					if (used[slot])
+					{
+						collision = true;
+						break;
+					}
+
+					used[slot] = true;
+					table.entries[slot] = values[i];
+				}
+
+				if (!collision)
+				{
+					return table;
+				}
+			}
+		}
+
+		// The empty slots have a value of 0, which is classified by the reserved button range.
+		static constexpr Table ClassifierTable = BuildTable();
+	}
+
+	constexpr uint8_t Classify(uint32_t value)
+	{
+		const detail::Entry& entry = detail::ClassifierTable.entries[detail::GetSlot(value, detail::ClassifierTable.multiplier)];
+
+		uint8_t flags = None;
+
+		if (entry.value == value)
+		{
+			flags = entry.flags;
+		}
+
+		if (value <= StyleControlReservedButtonRangeEnd)
+		{
+			flags |= ReservedButtonRange;
+		}
+
+		if (value >= 0x2000 && value <= 0x2003)
+		{
+			flags |= MaxisStyle;
+		}
+
+		if (value >= 0x3000 && value <= 0x3002)
+		{
+			flags |= IndustryType;
+		}
+
+		return flags;
+	}
+
+	// Gets the combined flags of all of the values.
+	constexpr uint8_t ClassifyAll(std::span<const uint32_t> values)
+	{
+		uint8_t flags = None;
+
+		for (const uint32_t value : values)
+		{
+			flags |= Classify(value);
+		}
+
+		return flags;
+	}
+}
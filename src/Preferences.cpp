@@ -29,7 +29,11 @@ Preferences::Preferences()
 	: logBuildingStyleSelection(false),
 	  logLotStyleSelection(false),
 	  logGrowableFunctions(false),
-	  logCandidateLots(false)
+	  logCandidateLots(false),
+	  logCacheStatistics(false),
+	  traceStyleSelection(false),
+	  collectHookStatistics(false),
+	  disableBuildingExemplarStyleCache(false)
 {
 }
 
@@ -58,6 +62,26 @@ bool Preferences::LogCandidateLots() const
 	return logCandidateLots;
 }
 
+bool Preferences::LogCacheStatistics() const
+{
+	return logCacheStatistics;
+}
+
+bool Preferences::TraceStyleSelection() const
+{
+	return traceStyleSelection;
+}
+
+bool Preferences::CollectHookStatistics() const
+{
+	return collectHookStatistics;
+}
+
+bool Preferences::DisableBuildingExemplarStyleCache() const
+{
+	return disableBuildingExemplarStyleCache;
+}
+
 void Preferences::LoadPreferencesFromDllConfigFile()
 {
 	Logger& logger = Logger::GetInstance();
@@ -78,6 +102,10 @@ void Preferences::LoadPreferencesFromDllConfigFile()
 			logLotStyleSelection = debugLoggingSection.get_converted_value<bool>("LotStyleSelection");
 			logGrowableFunctions = debugLoggingSection.get_converted_value<bool>("GrowableFunctions");
 			logCandidateLots = debugLoggingSection.get_converted_value<bool>("CandidateLots");
+			logCacheStatistics = debugLoggingSection.get_converted_value<bool>("CacheStatistics");
+			traceStyleSelection = debugLoggingSection.get_converted_value<bool>("StyleSelectionTrace");
+			collectHookStatistics = debugLoggingSection.get_converted_value<bool>("HookStatistics");
+			disableBuildingExemplarStyleCache = debugLoggingSection.get_converted_value<bool>("DisableBuildingExemplarStyleCache");
 		}
 		else
 		{
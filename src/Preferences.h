@@ -34,6 +34,10 @@ public:
 	bool LogLotStyleSelection() const;
 	bool LogGrowableFunctions() const;
 	bool LogCandidateLots() const;
+	bool LogCacheStatistics() const;
+	bool TraceStyleSelection() const;
+	bool CollectHookStatistics() const;
+	bool DisableBuildingExemplarStyleCache() const;
 
 private:
 	void LoadPreferencesFromDllConfigFile();
@@ -42,5 +46,9 @@ private:
 	bool logLotStyleSelection;
 	bool logGrowableFunctions;
 	bool logCandidateLots;
+	bool logCacheStatistics;
+	bool traceStyleSelection;
+	bool collectHookStatistics;
+	bool disableBuildingExemplarStyleCache;
 };
 
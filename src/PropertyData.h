@@ -24,6 +24,8 @@
 #include "cISCProperty.h"
 #include "cISCPropertyHolder.h"
 #include "cRZAutoRefCount.h"
+#include <algorithm>
+#include <cstdint>
 #include <span>
 #include <type_traits>
 
@@ -73,7 +75,7 @@ public:
 			if (repCount == 0)
 			{
 				// If the rep count is zero, the pointer's address is the value.
-				singleValue = reinterpret_cast<T>(pData);
+				singleValue = static_cast<T>(reinterpret_cast<uintptr_t>(pData));
 				span = std::span<T>(std::addressof(singleValue), 1);
 			}
 			else
@@ -97,7 +99,7 @@ public:
 			if (repCount == 0)
 			{
 				// If the rep count is zero, the pointer's address is the value.
-				singleValue = reinterpret_cast<T>(pData);
+				singleValue = static_cast<T>(reinterpret_cast<uintptr_t>(pData));
 				span = std::span<T>(std::addressof(singleValue), 1);
 			}
 			else
@@ -165,7 +167,7 @@ public:
 				if (repCount == 0)
 				{
 					// If the rep count is zero, the pointer's address is the value.
-					singleValue = reinterpret_cast<T>(pData);
+					singleValue = static_cast<T>(reinterpret_cast<uintptr_t>(pData));
 					span = std::span<T>(std::addressof(singleValue), 1);
 				}
 				else
@@ -245,7 +247,7 @@ private:
 		}
 		else
 		{
-			static_assert(false, "Unsupported integral type.");
+			static_assert(sizeof(T) == 0, "Unsupported integral type.");
 			return nullptr;
 		}
 	}
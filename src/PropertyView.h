@@ -0,0 +1,205 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "cIGZVariant.h"
+#include "cISCProperty.h"
+#include "cISCPropertyHolder.h"
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// A non-owning view of a property's values.
+//
+// Unlike PropertyData, this class does not hold a reference to the property's variant,
+// so it can be constructed and copied without calling AddRef/Release.
+// The view is only valid while the property holder it was loaded from is alive and
+// the property is not modified, callers that keep the values must copy them.
+template<typename T>
+class PropertyView
+{
+public:
+	static_assert(
+		std::is_same<T, bool>::value
+		|| std::is_same<T, uint8_t>::value
+		|| std::is_same<T, int8_t>::value
+		|| std::is_same<T, uint16_t>::value
+		|| std::is_same<T, int16_t>::value
+		|| std::is_same<T, uint32_t>::value
+		|| std::is_same<T, int32_t>::value
+		|| std::is_same<T, uint64_t>::value
+		|| std::is_same<T, int64_t>::value
+		|| std::is_same<T, float>::value
+		|| std::is_same<T, double>::value,
+		"Unsupported integral type.");
+
+	using container = std::span<const T>;
+	using iterator = const T*;
+
+	PropertyView() : pData(nullptr), count(0), singleValue(0)
+	{
+	}
+
+	PropertyView(cISCPropertyHolder* pPropertyHolder, uint32_t id)
+		: pData(nullptr), count(0), singleValue(0)
+	{
+		load(pPropertyHolder, id);
+	}
+
+	explicit operator bool() const noexcept
+	{
+		return !empty();
+	}
+
+	T operator[](size_t index) const
+	{
+		return data()[index];
+	}
+
+	iterator begin() const
+	{
+		return data();
+	}
+
+	iterator end() const
+	{
+		return data() + count;
+	}
+
+	bool contains(T value) const
+	{
+		return std::find(begin(), end(), value) != end();
+	}
+
+	const T* data() const
+	{
+		// The single value is stored in the view, so the pointer is resolved when it is
+		// accessed instead of when the view is loaded. This keeps copies of the view valid.
+		return pData ? pData : std::addressof(singleValue);
+	}
+
+	bool empty() const
+	{
+		return count == 0;
+	}
+
+	bool load(cISCPropertyHolder* pPropertyHolder, uint32_t id)
+	{
+		pData = nullptr;
+		count = 0;
+		singleValue = 0;
+
+		cISCProperty* pProperty = pPropertyHolder->GetProperty(id);
+
+		if (pProperty)
+		{
+			cIGZVariant* pVariant = pProperty->GetPropertyValue();
+
+			if (pVariant)
+			{
+				T* pVariantData = get_variant_data(pVariant);
+				uint32_t repCount = pVariant->GetCount();
+
+				if (repCount == 0)
+				{
+					// If the rep count is zero, the pointer's address is the value.
+					singleValue = static_cast<T>(reinterpret_cast<uintptr_t>(pVariantData));
+					count = 1;
+				}
+				else
+				{
+					pData = pVariantData;
+					count = repCount;
+				}
+			}
+		}
+
+		return !empty();
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	container values() const
+	{
+		return container(data(), count);
+	}
+private:
+	static T* get_variant_data(cIGZVariant* pVariant)
+	{
+		if constexpr (std::is_same<T, bool>::value)
+		{
+			return pVariant->RefBool();
+		}
+		else if constexpr (std::is_same<T, uint8_t>::value)
+		{
+			return pVariant->RefUint8();
+		}
+		else if constexpr (std::is_same<T, int8_t>::value)
+		{
+			return pVariant->RefSint8();
+		}
+		else if constexpr (std::is_same<T, uint16_t>::value)
+		{
+			return pVariant->RefUint16();
+		}
+		else if constexpr (std::is_same<T, int16_t>::value)
+		{
+			return pVariant->RefSint16();
+		}
+		else if constexpr (std::is_same<T, uint32_t>::value)
+		{
+			return pVariant->RefUint32();
+		}
+		else if constexpr (std::is_same<T, int32_t>::value)
+		{
+			return pVariant->RefSint32();
+		}
+		else if constexpr (std::is_same<T, uint64_t>::value)
+		{
+			return pVariant->RefUint64();
+		}
+		else if constexpr (std::is_same<T, int64_t>::value)
+		{
+			return pVariant->RefSint64();
+		}
+		else if constexpr (std::is_same<T, float>::value)
+		{
+			return pVariant->RefFloat32();
+		}
+		else if constexpr (std::is_same<T, double>::value)
+		{
+			return pVariant->RefFloat64();
+		}
+		else
+		{
+			static_assert(sizeof(T) == 0, "Unsupported integral type.");
+			return nullptr;
+		}
+	}
+
+	const T* pData;
+	uint32_t count;
+	T singleValue;
+};
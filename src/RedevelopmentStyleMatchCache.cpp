@@ -0,0 +1,85 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RedevelopmentStyleMatchCache.h"
+
+static constexpr size_t kMaxEntryCount = 16384;
+
+RedevelopmentStyleMatchCache::RedevelopmentStyleMatchCache()
+	: entries(),
+	  hitCount(0),
+	  missCount(0)
+{
+}
+
+bool RedevelopmentStyleMatchCache::find(
+	uint32_t existingBuildingType,
+	uint32_t newBuildingType,
+	std::optional<bool>& result)
+{
+	const auto it = entries.find(MakeKey(existingBuildingType, newBuildingType));
+
+	if (it != entries.end())
+	{
+		result = it->second;
+		hitCount++;
+		return true;
+	}
+
+	missCount++;
+	return false;
+}
+
+void RedevelopmentStyleMatchCache::insert(
+	uint32_t existingBuildingType,
+	uint32_t newBuildingType,
+	std::optional<bool> result)
+{
+	if (entries.size() >= kMaxEntryCount)
+	{
+		// Start over instead of tracking the least recently used entries, the
+		// pairs for the lots that are currently redeveloping will be re-added
+		// on their next check.
+		entries.clear();
+	}
+
+	entries.insert_or_assign(MakeKey(existingBuildingType, newBuildingType), result);
+}
+
+void RedevelopmentStyleMatchCache::clear()
+{
+	entries.clear();
+}
+
+uint64_t RedevelopmentStyleMatchCache::GetHitCount() const
+{
+	return hitCount;
+}
+
+uint64_t RedevelopmentStyleMatchCache::GetMissCount() const
+{
+	return missCount;
+}
+
+uint64_t RedevelopmentStyleMatchCache::MakeKey(uint32_t existingBuildingType, uint32_t newBuildingType)
+{
+	return (static_cast<uint64_t>(existingBuildingType) << 32) | newBuildingType;
+}
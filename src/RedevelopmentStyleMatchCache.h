@@ -0,0 +1,58 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+// Caches the PreventCrossStyleRedevelopment style match result for pairs of
+// existing and new building types.
+// The cache is cleared when it reaches its maximum size.
+class RedevelopmentStyleMatchCache
+{
+public:
+	RedevelopmentStyleMatchCache();
+
+	// Returns true if the cache contains a result for the building types.
+	// The result value will be empty if the building styles could not be compared.
+	bool find(
+		uint32_t existingBuildingType,
+		uint32_t newBuildingType,
+		std::optional<bool>& result);
+
+	void insert(
+		uint32_t existingBuildingType,
+		uint32_t newBuildingType,
+		std::optional<bool> result);
+
+	void clear();
+
+	uint64_t GetHitCount() const;
+	uint64_t GetMissCount() const;
+
+private:
+	static uint64_t MakeKey(uint32_t existingBuildingType, uint32_t newBuildingType);
+
+	std::unordered_map<uint64_t, std::optional<bool>> entries;
+	uint64_t hitCount;
+	uint64_t missCount;
+};
@@ -0,0 +1,107 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleCompatibilityEngine.h"
+#include "OccupantGroupClassifier.h"
+#include "PropertyIDs.h"
+#include "StyleListSearch.h"
+#include "WallToWallOccupantGroupIDs.h"
+#include <algorithm>
+
+bool StyleCompatibilityEngine::CheckWallToWallOption(IBuildingSelectWinContext::WallToWallOption option, bool isWallToWall)
+{
+	switch (option)
+	{
+	case IBuildingSelectWinContext::WallToWallOption::Only:
+		return isWallToWall;
+	case IBuildingSelectWinContext::WallToWallOption::Block:
+		return !isWallToWall;
+	case IBuildingSelectWinContext::WallToWallOption::Mixed:
+	default:
+		return true;
+	}
+}
+
+bool StyleCompatibilityEngine::HasWallToWallOccupantGroup(std::span<const uint32_t> occupantGroups)
+{
+	return (OccupantGroupClassifier::ClassifyAll(occupantGroups) & OccupantGroupClassifier::WallToWall) != 0;
+}
+
+uint32_t StyleCompatibilityEngine::GetIndustryTypeOccupantGroup(std::span<const uint32_t> occupantGroups)
+{
+	constexpr uint32_t kIndustryAnchor = 0x3000;
+	constexpr uint32_t kIndustryOut = 0x3002;
+
+	const auto it = std::find_if(
+		occupantGroups.begin(),
+		occupantGroups.end(),
+		[](uint32_t value)
+		{
+			return value >= kIndustryAnchor && value <= kIndustryOut;
+		});
+
+	return it != occupantGroups.end() ? *it : 0;
+}
+
+bool StyleCompatibilityEngine::ContainsStyle(std::span<const uint32_t> styles, uint32_t style)
+{
+	return StyleListSearch::Contains(styles, style);
+}
+
+bool StyleCompatibilityEngine::IsCompatibleWithAllStyles(bool hasBuildingStylesProperty, bool isIndustrial)
+{
+	return !hasBuildingStylesProperty && isIndustrial;
+}
+
+std::vector<uint32_t> StyleCompatibilityEngine::GetLotConfigurationStyleValues(
+	std::span<const uint32_t> buildingStyles,
+	bool isWallToWall,
+	std::span<const uint32_t> occupantGroups)
+{
+	std::vector<uint32_t> values;
+
+	if (!buildingStyles.empty())
+	{
+		values.reserve(buildingStyles.size() + 3);
+		values.insert(values.end(), buildingStyles.begin(), buildingStyles.end());
+
+		// Add the BuildingStyles property id to indicate that the property is present.
+		values.push_back(kBuildingStylesProperty);
+
+		if (isWallToWall)
+		{
+			// The exact W2W style doesn't matter, only the fact
+			// that it is present in the occupant groups.
+			values.push_back(GeneralWallToWallOccupantGroup);
+		}
+
+		// Copy over the industry type occupant groups.
+		// This is checked for industrial buildings in cSC4TractDeveloper::PickBuilding.
+		const uint32_t industryOccupantGroup = GetIndustryTypeOccupantGroup(occupantGroups);
+
+		if (industryOccupantGroup != 0)
+		{
+			values.push_back(industryOccupantGroup);
+		}
+	}
+
+	return values;
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "IBuildingSelectWinContext.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+// The style compatibility decisions that are used by the growth hooks.
+//
+// These functions only depend on the C++ standard library and the plugin's
+// own style data, so they can be built and tested without the game or the
+// Windows SDK. The callers are responsible for reading the values from the
+// game's exemplars and lot configurations.
+namespace StyleCompatibilityEngine
+{
+	// Gets a value indicating if a building or lot passes the Wall-to-Wall option.
+	bool CheckWallToWallOption(IBuildingSelectWinContext::WallToWallOption option, bool isWallToWall);
+
+	// Gets a value indicating if the list contains a Wall-to-Wall occupant group.
+	bool HasWallToWallOccupantGroup(std::span<const uint32_t> occupantGroups);
+
+	// Gets the industry type occupant group (0x3000-0x3002), or 0 if the list doesn't contain one.
+	uint32_t GetIndustryTypeOccupantGroup(std::span<const uint32_t> occupantGroups);
+
+	bool ContainsStyle(std::span<const uint32_t> styles, uint32_t style);
+
+	// Gets a value indicating if a building or lot is compatible with all styles without
+	// checking its style list.
+	// Industrial buildings without the Building Styles property are compatible with all styles.
+	bool IsCompatibleWithAllStyles(bool hasBuildingStylesProperty, bool isIndustrial);
+
+	// Gets the values that the lot configuration manager stores for a building that has a
+	// Building Styles property.
+	// The values are the building's styles, followed by the Building Styles property id,
+	// a W2W occupant group if the building is W2W, and the industry type occupant group.
+	// Returns an empty list when the building has no styles.
+	std::vector<uint32_t> GetLotConfigurationStyleValues(
+		std::span<const uint32_t> buildingStyles,
+		bool isWallToWall,
+		std::span<const uint32_t> occupantGroups);
+
+	// Checks if the new building shares at least one style with the old building.
+	// Only the new building's styles that are available in the UI are checked,
+	// the result has no value if none of them are available.
+	template<typename IsStyleAvailable>
+	std::optional<bool> StylesMatch(
+		std::span<const uint32_t> newBuildingStyles,
+		std::span<const uint32_t> oldBuildingStyles,
+		IsStyleAvailable&& isStyleAvailable)
+	{
+		std::optional<bool> result;
+
+		for (const uint32_t& style : newBuildingStyles)
+		{
+			if (isStyleAvailable(style))
+			{
+				result = ContainsStyle(oldBuildingStyles, style);
+
+				if (result.value())
+				{
+					break;
+				}
+			}
+		}
+
+		return result;
+	}
+}
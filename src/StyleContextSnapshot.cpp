@@ -0,0 +1,63 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleContextSnapshot.h"
+#include <atomic>
+
+static std::shared_ptr<const StyleContextSnapshot> gameThreadSnapshot = std::make_shared<const StyleContextSnapshot>();
+// The copy that is read by the other threads. A thread that loaded the previous
+// snapshot keeps a reference to it, the snapshot is freed when the last
+// reference is released.
+static std::atomic<std::shared_ptr<const StyleContextSnapshot>> sharedSnapshot(gameThreadSnapshot);
+
+std::span<const uint32_t> StyleContextSnapshot::GetStylesInUse() const
+{
+	std::span<const uint32_t> styles(activeStyles);
+
+	if (changeStylesEveryNYears != 0 && currentStyleIndex < styles.size())
+	{
+		styles = styles.subspan(currentStyleIndex, 1);
+	}
+
+	return styles;
+}
+
+std::shared_ptr<const StyleContextSnapshot> StyleContext::Acquire()
+{
+	return sharedSnapshot.load(std::memory_order_acquire);
+}
+
+const StyleContextSnapshot& StyleContext::Get()
+{
+	return *gameThreadSnapshot;
+}
+
+uint32_t StyleContext::Publish(StyleContextSnapshot snapshot)
+{
+	snapshot.epoch = gameThreadSnapshot->epoch + 1;
+
+	// The snapshot is fully constructed before it is published, so the
+	// readers never see a partially updated snapshot.
+	gameThreadSnapshot = std::make_shared<const StyleContextSnapshot>(std::move(snapshot));
+	sharedSnapshot.store(gameThreadSnapshot, std::memory_order_release);
+
+	return gameThreadSnapshot->epoch;
+}
@@ -0,0 +1,67 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "IBuildingSelectWinContext.h"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+// An immutable copy of the style selection settings that the growth hooks use.
+//
+// A new snapshot is published whenever the Building Style Control options, the
+// tract developer's active styles or the available UI styles change. Each snapshot
+// has a new epoch, which the style selection caches use to detect that their
+// results are out of date.
+struct StyleContextSnapshot
+{
+	uint32_t epoch = 0;
+	IBuildingSelectWinContext::WallToWallOption wallToWallOption = IBuildingSelectWinContext::WallToWallOption::Mixed;
+	LotZoningOptions lotZoningOptions = LotZoningOptionNone;
+	bool preventCrossStyleRedevelopment = false;
+	std::vector<uint32_t> activeStyles;
+	uint32_t currentStyleIndex = 0;
+	uint8_t changeStylesEveryNYears = 0;
+
+	// Gets the styles that the tract developer is using.
+	// Only the current style is used when the game is set to change styles every N years.
+	std::span<const uint32_t> GetStylesInUse() const;
+};
+
+namespace StyleContext
+{
+	// Gets the current snapshot from any thread.
+	// The snapshot is reference counted, it remains valid for as long as the caller
+	// holds it, even if a newer snapshot has been published.
+	std::shared_ptr<const StyleContextSnapshot> Acquire();
+
+	// Gets the current snapshot on the game thread.
+	// The game thread is the only thread that publishes snapshots, so it can read the
+	// current snapshot without an atomic operation. The reference is valid until the
+	// next Publish call.
+	const StyleContextSnapshot& Get();
+
+	// Publishes a new snapshot with the next epoch, the epoch of the snapshot
+	// parameter is ignored. This must be called on the game thread.
+	// Returns the new epoch.
+	uint32_t Publish(StyleContextSnapshot snapshot);
+}
@@ -0,0 +1,274 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleListSearch.h"
+#include <array>
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define STYLE_LIST_SEARCH_X86 1
+#define STYLE_LIST_SEARCH_TARGET_SSE2
+#define STYLE_LIST_SEARCH_TARGET_AVX2
+#elif defined(__i386__) || defined(__x86_64__)
+// GCC and Clang only allow the intrinsics in functions that target the instruction set.
+#include <immintrin.h>
+#define STYLE_LIST_SEARCH_X86 1
+#define STYLE_LIST_SEARCH_TARGET_SSE2 __attribute__((target("sse2")))
+#define STYLE_LIST_SEARCH_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace
+{
+	typedef bool(*pfn_Contains)(const uint32_t* pValues, size_t count, uint32_t value);
+
+	bool ContainsScalar(const uint32_t* pValues, size_t count, uint32_t value)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			if (pValues[i] == value)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+#ifdef STYLE_LIST_SEARCH_X86
+	STYLE_LIST_SEARCH_TARGET_SSE2 bool ContainsSSE2(const uint32_t* pValues, size_t count, uint32_t value)
+	{
+		const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+
+		size_t i = 0;
+
+		for (; (i + 4) <= count; i += 4)
+		{
+			const __m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pValues + i));
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(items, needle)) != 0)
+			{
+				return true;
+			}
+		}
+
+		return ContainsScalar(pValues + i, count - i, value);
+	}
+
+	STYLE_LIST_SEARCH_TARGET_AVX2 bool ContainsAVX2(const uint32_t* pValues, size_t count, uint32_t value)
+	{
+		bool result = false;
+
+		const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+
+		size_t i = 0;
+
+		for (; (i + 8) <= count; i += 8)
+		{
+			const __m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pValues + i));
+
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(items, needle)) != 0)
+			{
+				result = true;
+				break;
+			}
+		}
+
+		// Avoid the AVX to SSE transition penalty in the game's code.
+		_mm256_zeroupper();
+
+		return result || ContainsSSE2(pValues + i, count - i, value);
+	}
+
+	bool IsSSE2Supported()
+	{
+#if defined(_MSC_VER)
+		// SSE2 is the minimum instruction set for the Win32 build.
+		return true;
+#else
+		// The search function is selected by a static initializer, which can run
+		// before the compiler's CPU detection has been initialized.
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("sse2");
+#endif
+	}
+
+	bool IsAVX2Supported()
+	{
+#if defined(_MSC_VER)
+		int cpuInfo[4]{};
+
+		__cpuid(cpuInfo, 0);
+
+		if (cpuInfo[0] < 7)
+		{
+			return false;
+		}
+
+		__cpuid(cpuInfo, 1);
+
+		constexpr int OSXSAVE = 1 << 27;
+		constexpr int AVX = 1 << 28;
+
+		if ((cpuInfo[2] & (OSXSAVE | AVX)) != (OSXSAVE | AVX))
+		{
+			return false;
+		}
+
+		// The OS must save the YMM registers on a context switch.
+		if ((_xgetbv(0) & 6) != 6)
+		{
+			return false;
+		}
+
+		__cpuidex(cpuInfo, 7, 0);
+
+		constexpr int AVX2 = 1 << 5;
+
+		return (cpuInfo[1] & AVX2) != 0;
+#else
+		// This also checks that the OS saves the YMM registers on a context switch.
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+#endif // STYLE_LIST_SEARCH_X86
+
+	struct ContainsFunction
+	{
+		pfn_Contains function;
+		const char* name;
+	};
+
+	// Gets the search function for the instruction set, or nullptr if the
+	// compiler or the CPU does not support it.
+	pfn_Contains CreateContainsFunction(StyleListSearch::InstructionSet instructionSet)
+	{
+		switch (instructionSet)
+		{
+#ifdef STYLE_LIST_SEARCH_X86
+		case StyleListSearch::InstructionSet::AVX2:
+			return IsAVX2Supported() ? &ContainsAVX2 : nullptr;
+		case StyleListSearch::InstructionSet::SSE2:
+			return IsSSE2Supported() ? &ContainsSSE2 : nullptr;
+#endif // STYLE_LIST_SEARCH_X86
+		case StyleListSearch::InstructionSet::Scalar:
+			return &ContainsScalar;
+		default:
+			return nullptr;
+		}
+	}
+
+	// The CPU features are only checked once, when the DLL is loaded.
+	const std::array<pfn_Contains, 3> containsFunctions =
+	{
+		CreateContainsFunction(StyleListSearch::InstructionSet::Scalar),
+		CreateContainsFunction(StyleListSearch::InstructionSet::SSE2),
+		CreateContainsFunction(StyleListSearch::InstructionSet::AVX2),
+	};
+
+	pfn_Contains GetContainsFunction(StyleListSearch::InstructionSet instructionSet)
+	{
+		return containsFunctions[static_cast<size_t>(instructionSet)];
+	}
+
+	ContainsFunction SelectContainsFunction()
+	{
+		if (pfn_Contains function = GetContainsFunction(StyleListSearch::InstructionSet::AVX2))
+		{
+			return ContainsFunction{ function, "AVX2" };
+		}
+
+		if (pfn_Contains function = GetContainsFunction(StyleListSearch::InstructionSet::SSE2))
+		{
+			return ContainsFunction{ function, "SSE2" };
+		}
+
+		return ContainsFunction{ &ContainsScalar, "Scalar" };
+	}
+
+	const ContainsFunction containsFunction = SelectContainsFunction();
+}
+
+bool StyleListSearch::Contains(std::span<const uint32_t> values, uint32_t value)
+{
+	return containsFunction.function(values.data(), values.size(), value);
+}
+
+bool StyleListSearch::ContainsSorted(std::span<const uint32_t> sortedValues, uint32_t value)
+{
+	size_t count = sortedValues.size();
+
+	if (count == 0
+		|| value < sortedValues.front()
+		|| value > sortedValues.back())
+	{
+		return false;
+	}
+
+	// Each step only selects the half that is searched next.
+	const uint32_t* base = sortedValues.data();
+
+	while (count > 1)
+	{
+		const size_t half = count / 2;
+
+		base = base[half] <= value ? base + half : base;
+		count -= half;
+	}
+
+	return *base == value;
+}
+
+std::optional<uint32_t> StyleListSearch::FindFirstCommonValue(
+	std::span<const uint32_t> candidates,
+	std::span<const uint32_t> values)
+{
+	std::optional<uint32_t> result;
+
+	for (const uint32_t& candidate : candidates)
+	{
+		if (containsFunction.function(values.data(), values.size(), candidate))
+		{
+			result = candidate;
+			break;
+		}
+	}
+
+	return result;
+}
+
+bool StyleListSearch::IsInstructionSetSupported(InstructionSet instructionSet)
+{
+	return GetContainsFunction(instructionSet) != nullptr;
+}
+
+bool StyleListSearch::Contains(InstructionSet instructionSet, std::span<const uint32_t> values, uint32_t value)
+{
+	const pfn_Contains function = GetContainsFunction(instructionSet);
+
+	return function ? function(values.data(), values.size(), value) : false;
+}
+
+const char* StyleListSearch::GetInstructionSetName()
+{
+	return containsFunction.name;
+}
@@ -0,0 +1,63 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+
+// Searches the small style and occupant group lists that the growth hooks compare
+// when a precomputed style index is not available.
+//
+// The lists are compared several values at a time using SSE2 or AVX2, the
+// instruction set is selected when the DLL is loaded based on the CPU features.
+namespace StyleListSearch
+{
+	enum class InstructionSet
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	bool Contains(std::span<const uint32_t> values, uint32_t value);
+
+	// Gets a value indicating if the compiler and the CPU support the instruction set.
+	bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+	// Searches the values with the specified instruction set instead of the one that was
+	// selected when the DLL was loaded, this allows the tests and benchmarks to compare them.
+	// Returns false if the instruction set is not supported.
+	bool Contains(InstructionSet instructionSet, std::span<const uint32_t> values, uint32_t value);
+
+	// Searches a list that is sorted in ascending order.
+	// This is a branchless binary search, it is used for the larger lists
+	// that are built once per session.
+	bool ContainsSorted(std::span<const uint32_t> sortedValues, uint32_t value);
+
+	// Gets the first candidate that is present in the values.
+	std::optional<uint32_t> FindFirstCommonValue(
+		std::span<const uint32_t> candidates,
+		std::span<const uint32_t> values);
+
+	// Gets the name of the instruction set that is used for the searches.
+	const char* GetInstructionSetName();
+}
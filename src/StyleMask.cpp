@@ -0,0 +1,175 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleMask.h"
+#include <algorithm>
+#include <bit>
+
+StyleMask::StyleMask()
+	: bits()
+{
+}
+
+size_t StyleMask::GetWordCount(size_t bitCount)
+{
+	return (bitCount + (BitsPerWord - 1)) / BitsPerWord;
+}
+
+void StyleMask::reset(size_t bitCount)
+{
+	bits.assign(GetWordCount(bitCount), 0);
+}
+
+void StyleMask::set(uint32_t index)
+{
+	SetBit(bits, index);
+}
+
+void StyleMask::clear(uint32_t index)
+{
+	ClearBit(bits, index);
+}
+
+bool StyleMask::test(uint32_t index) const
+{
+	return TestBit(bits, index);
+}
+
+bool StyleMask::any() const
+{
+	return std::any_of(bits.begin(), bits.end(), [](word_type word) { return word != 0; });
+}
+
+size_t StyleMask::count() const
+{
+	return PopCount(bits);
+}
+
+StyleMask& StyleMask::operator&=(const StyleMask& other)
+{
+	const size_t wordCount = std::min(bits.size(), other.bits.size());
+
+	for (size_t i = 0; i < wordCount; i++)
+	{
+		bits[i] &= other.bits[i];
+	}
+
+	std::fill(bits.begin() + wordCount, bits.end(), 0);
+
+	return *this;
+}
+
+std::span<const StyleMask::word_type> StyleMask::words() const
+{
+	return bits;
+}
+
+std::optional<uint32_t> StyleMask::FindFirstCommonBit(
+	std::span<const word_type> lhs,
+	std::span<const word_type> rhs)
+{
+	std::optional<uint32_t> result;
+
+	const size_t wordCount = std::min(lhs.size(), rhs.size());
+
+	for (size_t i = 0; i < wordCount; i++)
+	{
+		const word_type common = lhs[i] & rhs[i];
+
+		if (common != 0)
+		{
+			result = static_cast<uint32_t>((i * BitsPerWord) + std::countr_zero(common));
+			break;
+		}
+	}
+
+	return result;
+}
+
+std::optional<uint32_t> StyleMask::FindFirstSetBit(std::span<const word_type> words)
+{
+	std::optional<uint32_t> result;
+
+	for (size_t i = 0; i < words.size(); i++)
+	{
+		if (words[i] != 0)
+		{
+			result = static_cast<uint32_t>((i * BitsPerWord) + std::countr_zero(words[i]));
+			break;
+		}
+	}
+
+	return result;
+}
+
+bool StyleMask::Intersects(std::span<const word_type> lhs, std::span<const word_type> rhs)
+{
+	const size_t wordCount = std::min(lhs.size(), rhs.size());
+
+	word_type common = 0;
+
+	// The words are combined without an early exit, the masks are only a few words long.
+	for (size_t i = 0; i < wordCount; i++)
+	{
+		common |= lhs[i] & rhs[i];
+	}
+
+	return common != 0;
+}
+
+size_t StyleMask::PopCount(std::span<const word_type> words)
+{
+	size_t count = 0;
+
+	for (const word_type word : words)
+	{
+		count += static_cast<size_t>(std::popcount(word));
+	}
+
+	return count;
+}
+
+void StyleMask::SetBit(std::span<word_type> words, uint32_t index)
+{
+	const size_t wordIndex = index / BitsPerWord;
+
+	if (wordIndex < words.size())
+	{
+		words[wordIndex] |= static_cast<word_type>(1) << (index % BitsPerWord);
+	}
+}
+
+void StyleMask::ClearBit(std::span<word_type> words, uint32_t index)
+{
+	const size_t wordIndex = index / BitsPerWord;
+
+	if (wordIndex < words.size())
+	{
+		words[wordIndex] &= ~(static_cast<word_type>(1) << (index % BitsPerWord));
+	}
+}
+
+bool StyleMask::TestBit(std::span<const word_type> words, uint32_t index)
+{
+	const size_t wordIndex = index / BitsPerWord;
+
+	return wordIndex < words.size() && (words[wordIndex] & (static_cast<word_type>(1) << (index % BitsPerWord))) != 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+// A bit set where each bit represents one of the dense style indexes
+// that the BuildingStyleIndex assigns to the available styles.
+// The width is fixed once the style index is initialized, so the set operations
+// work on whole words instead of individual style ids.
+class StyleMask
+{
+public:
+	using word_type = uint32_t;
+
+	static constexpr uint32_t BitsPerWord = 32;
+
+	StyleMask();
+
+	static size_t GetWordCount(size_t bitCount);
+
+	// Resizes the mask to hold the specified number of bits and clears all of the bits.
+	void reset(size_t bitCount);
+
+	void set(uint32_t index);
+	void clear(uint32_t index);
+	bool test(uint32_t index) const;
+	bool any() const;
+	// Gets the number of bits that are set.
+	size_t count() const;
+
+	// Clears the bits that are not set in the other mask.
+	StyleMask& operator&=(const StyleMask& other);
+
+	std::span<const word_type> words() const;
+
+	// Returns the lowest bit index that is set in both masks.
+	static std::optional<uint32_t> FindFirstCommonBit(
+		std::span<const word_type> lhs,
+		std::span<const word_type> rhs);
+
+	// Returns the lowest bit index that is set in the mask.
+	static std::optional<uint32_t> FindFirstSetBit(std::span<const word_type> words);
+
+	// Returns true if the masks have at least one bit in common.
+	static bool Intersects(std::span<const word_type> lhs, std::span<const word_type> rhs);
+
+	static size_t PopCount(std::span<const word_type> words);
+
+	static void SetBit(std::span<word_type> words, uint32_t index);
+	static void ClearBit(std::span<word_type> words, uint32_t index);
+	static bool TestBit(std::span<const word_type> words, uint32_t index);
+
+private:
+	std::vector<word_type> bits;
+};
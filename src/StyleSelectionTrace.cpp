@@ -0,0 +1,166 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleSelectionTrace.h"
+#include "Logger.h"
+#include "StyleSelectionTraceFormat.h"
+#include <type_traits>
+
+namespace
+{
+	constexpr size_t kTraceBufferSize = 256 * 1024;
+
+	using RecordType = StyleSelectionTraceFormat::RecordType;
+}
+
+StyleSelectionTrace::StyleSelectionTrace()
+	: buffer(),
+	  stream(),
+	  writtenBuildingTypes(),
+	  writtenLotConfigurations(),
+	  lastContextEpoch(0),
+	  hasContext(false)
+{
+}
+
+StyleSelectionTrace::~StyleSelectionTrace()
+{
+	Flush();
+}
+
+bool StyleSelectionTrace::Open(const std::filesystem::path& path)
+{
+	buffer = std::make_unique<char[]>(kTraceBufferSize);
+
+	// The buffer must be set before the file is opened.
+	stream.rdbuf()->pubsetbuf(buffer.get(), kTraceBufferSize);
+	stream.open(path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+	if (!stream)
+	{
+		Logger::GetInstance().WriteLine(LogLevel::Error, "Failed to open the style selection trace file.");
+		return false;
+	}
+
+	Write(StyleSelectionTraceFormat::Signature);
+	Write(StyleSelectionTraceFormat::Version);
+	return true;
+}
+
+void StyleSelectionTrace::Flush()
+{
+	if (stream.is_open())
+	{
+		stream.flush();
+	}
+}
+
+bool StyleSelectionTrace::IsOpen() const
+{
+	return stream.is_open();
+}
+
+bool StyleSelectionTrace::IsContextCurrent(uint32_t epoch) const
+{
+	return hasContext && lastContextEpoch == epoch;
+}
+
+void StyleSelectionTrace::WriteContext(const ContextInfo& context)
+{
+	if (!IsContextCurrent(context.epoch))
+	{
+		hasContext = true;
+		lastContextEpoch = context.epoch;
+
+		Write(RecordType::Context);
+		Write(context.epoch);
+		Write(context.wallToWallOption);
+		Write(context.lotZoningOptions);
+		Write(static_cast<uint8_t>(context.preventCrossStyleRedevelopment));
+		Write(context.changeStylesEveryNYears);
+		Write(context.currentStyleIndex);
+		Write(context.activeStyles);
+		Write(context.availableStyles);
+	}
+}
+
+void StyleSelectionTrace::WriteLotCheck(
+	uint32_t lotConfigurationID,
+	std::span<const uint32_t> occupantGroups,
+	uint32_t purpose,
+	bool result)
+{
+	if (writtenLotConfigurations.insert(lotConfigurationID).second)
+	{
+		Write(RecordType::LotConfigurationProperties);
+		Write(lotConfigurationID);
+		Write(occupantGroups);
+	}
+
+	Write(RecordType::LotCheck);
+	Write(lotConfigurationID);
+	Write(purpose);
+	Write(static_cast<uint8_t>(result));
+}
+
+void StyleSelectionTrace::WriteBuildingCheck(
+	uint32_t buildingType,
+	uint8_t buildingFlags,
+	std::span<const uint32_t> buildingStyles,
+	uint32_t purpose,
+	const CandidateLotInfo& candidateLot,
+	std::span<const uint32_t> existingBuildingStyles,
+	bool result)
+{
+	if (writtenBuildingTypes.insert(buildingType).second)
+	{
+		Write(RecordType::BuildingProperties);
+		Write(buildingType);
+		Write(buildingFlags);
+		Write(buildingStyles);
+	}
+
+	Write(RecordType::BuildingCheck);
+	Write(buildingType);
+	Write(purpose);
+	Write(candidateLot.developmentType);
+	Write(candidateLot.lotLocationX);
+	Write(candidateLot.lotLocationZ);
+	Write(candidateLot.lotSizeX);
+	Write(candidateLot.lotSizeZ);
+	Write(candidateLot.facing);
+	Write(candidateLot.existingBuildingType);
+	Write(existingBuildingStyles);
+	Write(static_cast<uint8_t>(result));
+}
+
+template<typename T> void StyleSelectionTrace::Write(T value)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void StyleSelectionTrace::Write(std::span<const uint32_t> values)
+{
+	Write(static_cast<uint32_t>(values.size()));
+	stream.write(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+}
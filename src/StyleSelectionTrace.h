@@ -0,0 +1,119 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <unordered_set>
+
+// Writes a compact binary trace of the growth style hook decisions.
+//
+// The file starts with a header of two uint32 values: the signature 'SBST' and the
+// format version, see StyleSelectionTraceFormat.h. The header is followed by a sequence of records, each record starts
+// with a uint8 record type. All values are little-endian.
+//
+// Context (1): uint32 epoch, uint8 W2W option, uint8 lot zoning options,
+// uint8 prevent cross-style redevelopment, uint8 change styles every N years,
+// uint32 current style index, uint32 active style count, uint32 active styles[count],
+// uint32 available style count, uint32 available styles[count].
+//
+// BuildingProperties (2): uint32 building type, uint8 record flags,
+// uint32 style count, uint32 styles[count].
+// Written the first time a building type appears in the trace.
+//
+// LotConfigurationProperties (3): uint32 lot configuration id,
+// uint32 occupant group count, uint32 occupant groups[count].
+// Written the first time a lot configuration appears in the trace.
+//
+// LotCheck (4): uint32 lot configuration id, uint32 purpose type, uint8 result.
+//
+// BuildingCheck (5): uint32 building type, uint32 purpose type, uint8 development type,
+// uint32 lot location x, uint32 lot location z, uint8 lot size x, uint8 lot size z,
+// uint8 facing, uint32 existing building type, uint32 existing building style count,
+// uint32 existing building styles[count], uint8 result.
+class StyleSelectionTrace
+{
+public:
+	struct ContextInfo
+	{
+		uint32_t epoch;
+		uint8_t wallToWallOption;
+		uint8_t lotZoningOptions;
+		bool preventCrossStyleRedevelopment;
+		uint8_t changeStylesEveryNYears;
+		uint32_t currentStyleIndex;
+		std::span<const uint32_t> activeStyles;
+		std::span<const uint32_t> availableStyles;
+	};
+
+	struct CandidateLotInfo
+	{
+		uint8_t developmentType;
+		uint32_t lotLocationX;
+		uint32_t lotLocationZ;
+		uint8_t lotSizeX;
+		uint8_t lotSizeZ;
+		uint8_t facing;
+		uint32_t existingBuildingType;
+	};
+
+	StyleSelectionTrace();
+	~StyleSelectionTrace();
+
+	bool Open(const std::filesystem::path& path);
+	void Flush();
+
+	bool IsOpen() const;
+
+	// Gets a value indicating if the context for the specified epoch was already written.
+	bool IsContextCurrent(uint32_t epoch) const;
+
+	void WriteContext(const ContextInfo& context);
+
+	void WriteLotCheck(
+		uint32_t lotConfigurationID,
+		std::span<const uint32_t> occupantGroups,
+		uint32_t purpose,
+		bool result);
+
+	void WriteBuildingCheck(
+		uint32_t buildingType,
+		uint8_t buildingFlags,
+		std::span<const uint32_t> buildingStyles,
+		uint32_t purpose,
+		const CandidateLotInfo& candidateLot,
+		std::span<const uint32_t> existingBuildingStyles,
+		bool result);
+
+private:
+	template<typename T> void Write(T value);
+	void Write(std::span<const uint32_t> values);
+
+	std::unique_ptr<char[]> buffer;
+	std::ofstream stream;
+	std::unordered_set<uint32_t> writtenBuildingTypes;
+	std::unordered_set<uint32_t> writtenLotConfigurations;
+	uint32_t lastContextEpoch;
+	bool hasContext;
+};
@@ -0,0 +1,85 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StyleSetTable.h"
+#include <algorithm>
+
+StyleSetTable::StyleSetTable()
+	: valuePool(),
+	  sets(),
+	  setsByHash()
+{
+}
+
+uint32_t StyleSetTable::intern(std::span<const uint32_t> values)
+{
+	const size_t hash = Hash(values);
+	const auto range = setsByHash.equal_range(hash);
+
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		const std::span<const uint32_t> existing = get(it->second);
+
+		if (std::equal(existing.begin(), existing.end(), values.begin(), values.end()))
+		{
+			return it->second;
+		}
+	}
+
+	const uint32_t id = static_cast<uint32_t>(sets.size());
+
+	sets.push_back(SetRange{ static_cast<uint32_t>(valuePool.size()), static_cast<uint32_t>(values.size()) });
+	valuePool.insert(valuePool.end(), values.begin(), values.end());
+	setsByHash.emplace(hash, id);
+
+	return id;
+}
+
+std::span<const uint32_t> StyleSetTable::get(uint32_t id) const
+{
+	const SetRange& range = sets[id];
+
+	return std::span<const uint32_t>(valuePool.data() + range.offset, range.count);
+}
+
+size_t StyleSetTable::size() const
+{
+	return sets.size();
+}
+
+size_t StyleSetTable::GetValueCount() const
+{
+	return valuePool.size();
+}
+
+size_t StyleSetTable::Hash(std::span<const uint32_t> values)
+{
+	// FNV-1a over the values.
+	size_t hash = static_cast<size_t>(2166136261U);
+
+	for (const uint32_t value : values)
+	{
+		hash ^= value;
+		hash *= static_cast<size_t>(16777619U);
+	}
+
+	return hash;
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// A hash-consed table of immutable style sets.
+//
+// Each distinct list of values is stored once and identified by a dense id,
+// so lists that are equal have the same id and can be compared or cached by id.
+// The values are kept in their original order.
+class StyleSetTable
+{
+public:
+	StyleSetTable();
+
+	// Gets the id of the set that contains the specified values, adding it if necessary.
+	uint32_t intern(std::span<const uint32_t> values);
+
+	std::span<const uint32_t> get(uint32_t id) const;
+
+	// Gets the number of distinct sets.
+	size_t size() const;
+
+	// Gets the total number of values stored for the distinct sets.
+	size_t GetValueCount() const;
+
+private:
+	struct SetRange
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	static size_t Hash(std::span<const uint32_t> values);
+
+	std::vector<uint32_t> valuePool;
+	std::vector<SetRange> sets;
+	std::unordered_multimap<size_t, uint32_t> setsByHash;
+};
@@ -20,10 +20,11 @@
  */
 
 #include "TractDeveloperHooks.h"
+#include "ActiveStyleMask.h"
+#include "BuildingCompatibilityTableBuilder.h"
+#include "BuildingStyleCatalog.h"
 #include "BuildingUtil.h"
 #include "BuildingStyleUtil.h"
-#include "cGZPersistResourceKey.h"
-#include "cIGZPersistResourceManager.h"
 #include "cIGZString.h"
 #include "cIGZVariant.h"
 #include "cISCProperty.h"
@@ -35,20 +36,31 @@
 #include "cISC4LotConfiguration.h"
 #include "cISC4Occupant.h"
 #include "cRZAutoRefCount.h"
+#include "cSC4LotConfiguration.h"
+#include "FileSystem.h"
 #include "GlobalPointers.h"
-#include "GZServPtrs.h"
+#include "HookStatistics.h"
 #include "Logger.h"
+#include "LotConfigurationManagerHooks.h"
+#include "LotConfigurationStyleIndex.h"
+#include "LotStyleCompatibilityCache.h"
 #include "Patcher.h"
-#include "PropertyData.h"
 #include "PropertyIDs.h"
+#include "RedevelopmentStyleMatchCache.h"
 #include "SC4Rect.h"
 #include "SC4String.h"
 #include "SC4Vector.h"
 #include "SC4VersionDetection.h"
-#include "WallToWallOccupantGroups.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleContextSnapshot.h"
+#include "StyleListSearch.h"
+#include "StyleSelectionTrace.h"
+#include <algorithm>
+#include <array>
 #include <format>
 #include <optional>
 #include <span>
+#include <vector>
 
 #include "wil/result.h"
 
@@ -140,52 +152,312 @@ static_assert(offsetof(cSC4TractDeveloper, activeStyles) == 0x118);
 static_assert(offsetof(cSC4TractDeveloper, currentStyleIndex) == 0x124);
 static_assert(offsetof(cSC4TractDeveloper, changeStylesEveryNYears) == 0x12c);
 
-struct cSC4LotConfiguration
+// The precomputed compatible sets for a single style, these are used when the
+// game is set to change styles every N years.
+// The lists are copied because the lot configuration style index rebuilds its posting
+// lists when a lot configuration is added, and the next city creates new lot configurations.
+struct RotationStyleSets
 {
-	void* vtable;
-	uint32_t refCount;
-	uint32_t id;
-	SC4String name;
-	uint8_t unknown1[0x60];
-	SC4Vector<uint32_t> buildingOccupantGroups;
+	uint32_t style = 0;
+	// Sorted lists of the building types and lot configurations whose style
+	// or occupant group lists contain the style.
+	std::vector<uint32_t> buildingTypes;
+	std::vector<const void*> lotConfigurations;
+	// The LotConfigurationStyleIndex generation that the lot configurations were copied from.
+	uint32_t lotConfigurationGeneration = 0;
+	bool valid = false;
 };
 
-static_assert(offsetof(cSC4LotConfiguration, buildingOccupantGroups) == 0x80);
+struct StyleSelectionState
+{
+	ActiveStyleMask activeStyleMask;
+	// The following fields are used to detect changes to the tract developer's
+	// active style list that were not reported through ActiveStylesChanged, e.g.
+	// the game advancing to the next style in the "change style every N years" mode.
+	const uint32_t* pActiveStyles = nullptr;
+	size_t activeStyleCount = 0;
+	uint32_t currentStyleIndex = 0;
+	uint8_t changeStylesEveryNYears = 0;
+	bool activeStylesDirty = true;
+	RotationStyleSets currentRotationStyle;
+	RotationStyleSets nextRotationStyle;
+};
 
-static uintptr_t IsLotConfigurationSuitable_CompatableStyleFound_Continue;
-static uintptr_t IsLotConfigurationSuitable_NoCompatableStyle_Continue;
+static StyleSelectionState styleSelectionState;
+static LotStyleCompatibilityCache lotStyleCompatibilityCache;
+// Lot configurations with the same style set always have the same result,
+// so the lot configurations that have a style set are cached by its id.
+static LotStyleCompatibilityCache lotStyleSetCompatibilityCache;
+static BuildingCompatibilityTableBuilder buildingCompatibilityTableBuilder;
+// The building compatibility table for the current epoch, or nullptr if it is not ready.
+static const BuildingCompatibilityTable* pBuildingCompatibilityTable = nullptr;
+static StyleSelectionTrace styleSelectionTrace;
+
+static bool hookStatisticsEnabled = false;
+static HookStatistics isLotConfigurationSuitableStatistics("IsLotConfigurationSuitable");
+static HookStatistics isBuildingCompatibleStatistics("IsBuildingCompatible");
+static HookStatistics takeOverAbandonedStatistics("TakeOverAbandoned");
+static HookStatistics listPossibleLotConfigurationsStatistics("ListPossibleLotConfigurations");
+static HookStatistics listCandidateLotsExistingStatistics("ListCandidateLots_Existing");
+static HookStatistics listCandidateLotsAggregationStatistics("ListCandidateLots_Aggregation");
+static HookStatistics listCandidateLotsSubdivisionStatistics("ListCandidateLots_Subdivision");
+static HookStatistics buildStatistics("Build");
+static HookStatistics buildFarmStatistics("BuildFarm");
+
+static const std::array<const HookStatistics*, 9> allHookStatistics =
+{
+	&isLotConfigurationSuitableStatistics,
+	&isBuildingCompatibleStatistics,
+	&takeOverAbandonedStatistics,
+	&listPossibleLotConfigurationsStatistics,
+	&listCandidateLotsExistingStatistics,
+	&listCandidateLotsAggregationStatistics,
+	&listCandidateLotsSubdivisionStatistics,
+	&buildStatistics,
+	&buildFarmStatistics,
+};
 
-static bool LotConfigurationHasOccupantGroupValue(const cSC4LotConfiguration* pLotConfiguration, uint32_t value)
+template<typename Function>
+static auto MeasureHookCall(HookStatistics& statistics, Function&& function)
 {
-	const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+	if (hookStatisticsEnabled)
+	{
+		HookStatisticsTimer timer(statistics);
+		return function();
+	}
+
+	return function();
+}
+
+static std::span<const uint32_t> GetStylesInUse(const cSC4TractDeveloper* pThis)
+{
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+	std::span<const uint32_t> styles(activeStyles.begin(), activeStyles.size());
+
+	if (pThis->changeStylesEveryNYears != 0 && pThis->currentStyleIndex < styles.size())
+	{
+		// Only the current style is used when the game is set to change styles every N years.
+		styles = styles.subspan(pThis->currentStyleIndex, 1);
+	}
+
+	return styles;
+}
+
+static RotationStyleSets GetRotationStyleSets(uint32_t style)
+{
+	RotationStyleSets sets;
+
+	const BuildingStyleCatalog& catalog = spBuildingSelectWinManager->GetBuildingStyleCatalog();
+	const std::optional<uint32_t> index = catalog.GetStyleIndex(style);
+
+	// Styles without a catalog index use the standard style checks.
+	if (index.has_value())
+	{
+		LotConfigurationStyleIndex& lotConfigurationStyleIndex = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+
+		const std::span<const uint32_t> buildingTypes = catalog.GetBuildingTypesWithStyleIndex(index.value());
+		const std::span<const void* const> lotConfigurations = lotConfigurationStyleIndex.GetLotConfigurationsWithValue(style);
+
+		sets.style = style;
+		sets.buildingTypes.assign(buildingTypes.begin(), buildingTypes.end());
+		sets.lotConfigurations.assign(lotConfigurations.begin(), lotConfigurations.end());
+		sets.lotConfigurationGeneration = lotConfigurationStyleIndex.GetLotConfigurationGeneration();
+		sets.valid = true;
+	}
+
+	return sets;
+}
+
+static bool IsRotationStyleSetCurrent(const RotationStyleSets& sets)
+{
+	return sets.valid
+		&& sets.lotConfigurationGeneration == LotConfigurationManagerHooks::GetLotConfigurationStyleIndex().GetLotConfigurationGeneration();
+}
 
-	for (const auto& occupantGroup : buildingOccupantGroups)
+static void UpdateRotationStyleSets(const cSC4TractDeveloper* pThis, StyleSelectionState& state)
+{
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+
+	if (pThis->changeStylesEveryNYears != 0 && pThis->currentStyleIndex < activeStyles.size())
 	{
-		if (occupantGroup == value)
+		const uint32_t currentStyle = activeStyles[pThis->currentStyleIndex];
+
+		if (IsRotationStyleSetCurrent(state.nextRotationStyle) && state.nextRotationStyle.style == currentStyle)
 		{
-			return true;
+			// The sets for the new style were prepared before the rotation.
+			std::swap(state.currentRotationStyle, state.nextRotationStyle);
 		}
+		else
+		{
+			state.currentRotationStyle = GetRotationStyleSets(currentStyle);
+		}
+
+		const size_t nextStyleIndex = (static_cast<size_t>(pThis->currentStyleIndex) + 1) % activeStyles.size();
+
+		state.nextRotationStyle = GetRotationStyleSets(activeStyles[nextStyleIndex]);
+	}
+	else
+	{
+		state.currentRotationStyle = RotationStyleSets();
+		state.nextRotationStyle = RotationStyleSets();
 	}
+}
 
-	return false;
+static uint32_t PublishActiveStyles(const cSC4TractDeveloper* pThis)
+{
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+
+	StyleContextSnapshot snapshot = StyleContext::Get();
+	snapshot.activeStyles.assign(activeStyles.begin(), activeStyles.end());
+	snapshot.currentStyleIndex = pThis->currentStyleIndex;
+	snapshot.changeStylesEveryNYears = pThis->changeStylesEveryNYears;
+
+	return StyleContext::Publish(std::move(snapshot));
 }
 
-template<size_t N>
-static bool LotConfigurationHasOccupantGroupValue(
-	const cSC4LotConfiguration* pLotConfiguration,
-	const frozen::unordered_map<uint32_t, const std::string_view, N>& values)
+static const ActiveStyleMask& GetActiveStyleMask(const cSC4TractDeveloper* pThis)
 {
-	const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+	StyleSelectionState& state = styleSelectionState;
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+
+	if (state.activeStylesDirty
+		|| state.pActiveStyles != activeStyles.begin()
+		|| state.activeStyleCount != activeStyles.size()
+		|| state.currentStyleIndex != pThis->currentStyleIndex
+		|| state.changeStylesEveryNYears != pThis->changeStylesEveryNYears)
+	{
+		state.activeStyleMask.Update(spBuildingSelectWinManager->GetBuildingStyleCatalog(), GetStylesInUse(pThis));
+		UpdateRotationStyleSets(pThis, state);
+		state.pActiveStyles = activeStyles.begin();
+		state.activeStyleCount = activeStyles.size();
+		state.currentStyleIndex = pThis->currentStyleIndex;
+		state.changeStylesEveryNYears = pThis->changeStylesEveryNYears;
+		state.activeStylesDirty = false;
+		PublishActiveStyles(pThis);
+	}
+	else if (state.currentRotationStyle.valid && !IsRotationStyleSetCurrent(state.currentRotationStyle))
+	{
+		// The lot configurations changed after the rotation style sets were built.
+		UpdateRotationStyleSets(pThis, state);
+	}
+
+	return state.activeStyleMask;
+}
+
+static uint32_t GetStyleSelectionEpoch(const cSC4TractDeveloper* pThis)
+{
+	// GetActiveStyleMask will publish a new snapshot if the active styles have changed,
+	// the Building Style Control options are published when they are set.
+	GetActiveStyleMask(pThis);
+
+	return StyleContext::Get().epoch;
+}
+
+static void TraceStyleSelectionContext(const cSC4TractDeveloper* pThis, uint32_t epoch)
+{
+	if (styleSelectionTrace.IsContextCurrent(epoch))
+	{
+		return;
+	}
+
+	const StyleContextSnapshot& snapshot = StyleContext::Get();
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+
+	// The replay tool uses the available styles for the cross-style redevelopment check.
+	std::vector<uint32_t> availableStyles;
+
+	for (const BuildingStyleCollectionEntry& entry : spBuildingSelectWinManager->GetAvailableBuildingStyles())
+	{
+		availableStyles.push_back(entry.styleID);
+	}
+
+	StyleSelectionTrace::ContextInfo context{};
+	context.epoch = epoch;
+	context.wallToWallOption = static_cast<uint8_t>(snapshot.wallToWallOption);
+	context.lotZoningOptions = static_cast<uint8_t>(snapshot.lotZoningOptions);
+	context.preventCrossStyleRedevelopment = snapshot.preventCrossStyleRedevelopment;
+	context.changeStylesEveryNYears = pThis->changeStylesEveryNYears;
+	context.currentStyleIndex = pThis->currentStyleIndex;
+	context.activeStyles = std::span<const uint32_t>(activeStyles.begin(), activeStyles.size());
+	context.availableStyles = availableStyles;
+
+	styleSelectionTrace.WriteContext(context);
+}
+
+static uint32_t GetFirstActiveStyle(const cSC4TractDeveloper* pThis)
+{
+	if (pThis->changeStylesEveryNYears == 0)
+	{
+		return pThis->activeStyles[0];
+	}
+	else
+	{
+		return pThis->activeStyles[pThis->currentStyleIndex];
+	}
+}
 
-	for (const auto& occupantGroup : buildingOccupantGroups)
+// The style masks find the matching style with the lowest style index, the success log
+// messages name the first matching style in the active style order like the game's check.
+static uint32_t GetFirstActiveStyleInList(
+	const cSC4TractDeveloper* pThis,
+	std::span<const uint32_t> styles,
+	uint32_t matchingStyle)
+{
+	for (const uint32_t& style : GetStylesInUse(pThis))
 	{
-		if (values.count(occupantGroup) != 0)
+		if (std::find(styles.begin(), styles.end(), style) != styles.end())
 		{
-			return true;
+			return style;
 		}
 	}
 
-	return false;
+	return matchingStyle;
+}
+
+static uintptr_t IsLotConfigurationSuitable_CompatableStyleFound_Continue;
+static uintptr_t IsLotConfigurationSuitable_NoCompatableStyle_Continue;
+
+static bool LotConfigurationHasOccupantGroupValue(const cSC4LotConfiguration* pLotConfiguration, uint32_t value)
+{
+	const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+
+	return StyleListSearch::Contains(
+		std::span<const uint32_t>(buildingOccupantGroups.begin(), buildingOccupantGroups.size()),
+		value);
+}
+
+// The lot configurations that were seen by the GetBuildingStyles hook have a style set,
+// its metadata is used instead of scanning the occupant groups for the marker values.
+
+static bool LotConfigurationHasBuildingStylesProperty(
+	const cSC4LotConfiguration* pLotConfiguration,
+	std::optional<uint32_t> styleSetID)
+{
+	if (styleSetID.has_value())
+	{
+		const LotConfigurationStyleIndex& index = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+
+		return index.GetStyleSetMetadata(styleSetID.value()).hasBuildingStylesProperty;
+	}
+
+	return LotConfigurationHasOccupantGroupValue(pLotConfiguration, kBuildingStylesProperty);
+}
+
+static bool LotConfigurationIsWallToWall(
+	const cSC4LotConfiguration* pLotConfiguration,
+	std::optional<uint32_t> styleSetID)
+{
+	if (styleSetID.has_value())
+	{
+		const LotConfigurationStyleIndex& index = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+
+		return index.GetStyleSetMetadata(styleSetID.value()).isWallToWall;
+	}
+
+	const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+
+	return StyleCompatibilityEngine::HasWallToWallOccupantGroup(
+		std::span<const uint32_t>(buildingOccupantGroups.begin(), buildingOccupantGroups.size()));
 }
 
 static void LogPurposeTypeDoesNotSupportStyles(
@@ -408,24 +680,18 @@ static bool DoesLotSupportBuildingStyles(
 	return true;
 }
 
-static bool CheckAdditionalLotStyleOptions(const cSC4LotConfiguration* pLotConfiguration)
+template<IBuildingSelectWinContext::WallToWallOption wallToWallOption>
+static bool CheckAdditionalLotStyleOptions(
+	const cSC4LotConfiguration* pLotConfiguration,
+	std::optional<uint32_t> styleSetID)
 {
 	bool result = true;
 
-	const IBuildingSelectWinContext& context = spBuildingSelectWinManager->GetContext();
-	const IBuildingSelectWinContext::WallToWallOption wallToWallOption = context.GetWallToWallOption();
-
-	if (wallToWallOption != IBuildingSelectWinContext::WallToWallOption::Mixed)
+	if constexpr (wallToWallOption != IBuildingSelectWinContext::WallToWallOption::Mixed)
 	{
-		switch (wallToWallOption)
-		{
-		case IBuildingSelectWinContext::WallToWallOption::Only:
-			result = LotConfigurationHasOccupantGroupValue(pLotConfiguration, WallToWallOccupantGroups);
-			break;
-		case IBuildingSelectWinContext::WallToWallOption::Block:
-			result = !LotConfigurationHasOccupantGroupValue(pLotConfiguration, WallToWallOccupantGroups);
-			break;
-		}
+		result = StyleCompatibilityEngine::CheckWallToWallOption(
+			wallToWallOption,
+			LotConfigurationIsWallToWall(pLotConfiguration, styleSetID));
 
 		if (!result && spPreferences->LogLotStyleSelection())
 		{
@@ -454,76 +720,53 @@ template<bool isBuildingStyleProperty>
 static bool CheckLotCompatibilityWithActiveStyles(
 	const cSC4TractDeveloper* pThis,
 	const cSC4LotConfiguration* pLotConfiguration,
-	cISC4BuildingOccupant::PurposeType purpose)
+	cISC4BuildingOccupant::PurposeType purpose,
+	std::optional<uint32_t> styleSetID)
 {
-	if (pThis->changeStylesEveryNYears == 0)
+	if (StyleCompatibilityEngine::IsCompatibleWithAllStyles(
+		isBuildingStyleProperty,
+		BuildingUtil::IsIndustrialBuilding(purpose)))
 	{
-		// Use all styles at once.
+		// Industrial buildings without a BuildingStyles property
+		// are compatible with all building styles.
+		LogLotStyleSupported(pLotConfiguration, GetFirstActiveStyle(pThis));
+		return true;
+	}
 
-		const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+	const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+	const RotationStyleSets& rotationStyle = styleSelectionState.currentRotationStyle;
 
-		for (const auto& style : activeStyles)
-		{
-			if constexpr (isBuildingStyleProperty)
-			{
-				if (LotConfigurationHasOccupantGroupValue(pLotConfiguration, style))
-				{
-					LogLotStyleSupported(pLotConfiguration, style);
-					return true;
-				}
-			}
-			else
-			{
-				if (BuildingUtil::IsIndustrialBuilding(purpose))
-				{
-					// Industrial buildings without a BuildingStyles property
-					// are compatible with all building styles.
-					LogLotStyleSupported(pLotConfiguration, style);
-					return true;
-				}
-				else
-				{
-					if (LotConfigurationHasOccupantGroupValue(pLotConfiguration, style))
-					{
-						LogLotStyleSupported(pLotConfiguration, style);
-						return true;
-					}
-				}
-			}
-		}
-	}
-	else
+	if (IsRotationStyleSetCurrent(rotationStyle)
+		&& std::binary_search(
+			rotationStyle.lotConfigurations.begin(),
+			rotationStyle.lotConfigurations.end(),
+			static_cast<const void*>(&buildingOccupantGroups)))
 	{
-		// Change style every N years.
-
-		const uint32_t activeStyle = pThis->activeStyles[pThis->currentStyleIndex];
+		LogLotStyleSupported(pLotConfiguration, rotationStyle.style);
+		return true;
+	}
 
-		if constexpr (isBuildingStyleProperty)
-		{
-			if (LotConfigurationHasOccupantGroupValue(pLotConfiguration, activeStyle))
-			{
-				LogLotStyleSupported(pLotConfiguration, activeStyle);
-				return true;
-			}
-		}
-		else
+	// Lot configurations that were not seen by the GetBuildingStyles hook are not
+	// in the rotation style sets and do not have a style mask, so they always use
+	// the occupant group scan.
+	const ActiveStyleMask& activeStyleMask = GetActiveStyleMask(pThis);
+	const std::span<const uint32_t> occupantGroups(buildingOccupantGroups.begin(), buildingOccupantGroups.size());
+	const std::optional<std::span<const StyleMask::word_type>> styleMask = styleSetID.has_value()
+		? LotConfigurationManagerHooks::GetLotConfigurationStyleIndex().GetStyleMask(styleSetID.value())
+		: std::nullopt;
+	uint32_t style = 0;
+
+	const bool hasActiveStyle = styleMask.has_value()
+		? activeStyleMask.FindFirstMatch(styleMask.value(), occupantGroups, style)
+		: activeStyleMask.FindFirstMatch(occupantGroups, style);
+
+	if (hasActiveStyle)
+	{
+		if (spPreferences->LogLotStyleSelection())
 		{
-			if (BuildingUtil::IsIndustrialBuilding(purpose))
-			{
-				// Industrial buildings without a BuildingStyles property
-				// are compatible with all building styles.
-				LogLotStyleSupported(pLotConfiguration, activeStyle);
-				return true;
-			}
-			else
-			{
-				if (LotConfigurationHasOccupantGroupValue(pLotConfiguration, activeStyle))
-				{
-					LogLotStyleSupported(pLotConfiguration, activeStyle);
-					return true;
-				}
-			}
+			LogLotStyleSupported(pLotConfiguration, GetFirstActiveStyleInList(pThis, occupantGroups, style));
 		}
+		return true;
 	}
 
 	if (spPreferences->LogLotStyleSelection())
@@ -535,29 +778,194 @@ static bool CheckLotCompatibilityWithActiveStyles(
 	return false;
 }
 
-static bool IsLotCompatibleWithActiveStyles(
+typedef bool(*pfn_LotStyleKernel)(
 	const cSC4TractDeveloper* pThis,
 	const cSC4LotConfiguration* pLotConfiguration,
-	cISC4BuildingOccupant::PurposeType purpose)
+	cISC4BuildingOccupant::PurposeType purpose,
+	std::optional<uint32_t> styleSetID);
+
+template<IBuildingSelectWinContext::WallToWallOption wallToWallOption>
+static bool LotStyleKernel(
+	const cSC4TractDeveloper* pThis,
+	const cSC4LotConfiguration* pLotConfiguration,
+	cISC4BuildingOccupant::PurposeType purpose,
+	std::optional<uint32_t> styleSetID)
 {
-	if (!CheckAdditionalLotStyleOptions(pLotConfiguration))
+	if (!CheckAdditionalLotStyleOptions<wallToWallOption>(pLotConfiguration, styleSetID))
 	{
 		// CheckAdditionalLotStyleOptions already wrote a failure log message.
 		return false;
 	}
 
-	const bool hasBuildingStylesProperty = LotConfigurationHasOccupantGroupValue(pLotConfiguration, kBuildingStylesProperty);
+	const bool hasBuildingStylesProperty = LotConfigurationHasBuildingStylesProperty(pLotConfiguration, styleSetID);
 
 	if (hasBuildingStylesProperty)
 	{
 		// CheckLotCompatibilityWithActiveStyles will write the success/failure log messages.
-		return CheckLotCompatibilityWithActiveStyles<true>(pThis, pLotConfiguration, purpose);
+		return CheckLotCompatibilityWithActiveStyles<true>(pThis, pLotConfiguration, purpose, styleSetID);
 	}
 	else
 	{
 		// CheckLotCompatibilityWithActiveStyles will write the success/failure log messages.
-		return CheckLotCompatibilityWithActiveStyles<false>(pThis, pLotConfiguration, purpose);
+		return CheckLotCompatibilityWithActiveStyles<false>(pThis, pLotConfiguration, purpose, styleSetID);
+	}
+}
+
+static pfn_LotStyleKernel SelectLotStyleKernel(IBuildingSelectWinContext::WallToWallOption wallToWallOption)
+{
+	switch (wallToWallOption)
+	{
+	case IBuildingSelectWinContext::WallToWallOption::Only:
+		return &LotStyleKernel<IBuildingSelectWinContext::WallToWallOption::Only>;
+	case IBuildingSelectWinContext::WallToWallOption::Block:
+		return &LotStyleKernel<IBuildingSelectWinContext::WallToWallOption::Block>;
+	case IBuildingSelectWinContext::WallToWallOption::Mixed:
+	default:
+		return &LotStyleKernel<IBuildingSelectWinContext::WallToWallOption::Mixed>;
+	}
+}
+
+static pfn_LotStyleKernel lotStyleKernel = nullptr;
+static uint32_t lotStyleKernelEpoch = 0;
+
+// The layout of the list that ListPossibleLotConfigurations builds is not known, so the
+// list is not narrowed and the game still calls the IsLotConfigurationSuitable hook for
+// every zone-compatible lot configuration.
+// The inverted index only lowers the cost of each of those calls, a lot configuration
+// without any of the styles in use is rejected before the cache lookup and the kernel.
+static bool LotMayContainActiveStyle(
+	const cSC4LotConfiguration* pLotConfiguration,
+	cISC4BuildingOccupant::PurposeType purpose,
+	uint32_t styleSetID)
+{
+	if (BuildingUtil::IsIndustrialBuilding(purpose)
+		&& !LotConfigurationHasBuildingStylesProperty(pLotConfiguration, styleSetID))
+	{
+		// Industrial buildings without a BuildingStyles property
+		// are compatible with all building styles.
+		return true;
+	}
+
+	return LotConfigurationManagerHooks::GetLotConfigurationStyleIndex().MayContainActiveStyle(styleSetID);
+}
+
+static bool CheckLotCompatibilityUsingCache(
+	LotStyleCompatibilityCache& cache,
+	uint32_t cacheKey,
+	const cSC4TractDeveloper* pThis,
+	const cSC4LotConfiguration* pLotConfiguration,
+	cISC4BuildingOccupant::PurposeType purpose,
+	std::optional<uint32_t> styleSetID,
+	uint32_t epoch)
+{
+	bool result = false;
+
+	const std::optional<bool> cachedResult = cache.find(cacheKey, purpose, epoch);
+
+	if (cachedResult.has_value())
+	{
+		result = cachedResult.value();
+	}
+	else
+	{
+		result = lotStyleKernel(pThis, pLotConfiguration, purpose, styleSetID);
+
+		cache.insert(cacheKey, purpose, epoch, result);
+	}
+
+	return result;
+}
+
+static bool IsLotCompatibleWithActiveStyles(
+	const cSC4TractDeveloper* pThis,
+	const cSC4LotConfiguration* pLotConfiguration,
+	cISC4BuildingOccupant::PurposeType purpose)
+{
+	const uint32_t epoch = GetStyleSelectionEpoch(pThis);
+
+	if (!lotStyleKernel || lotStyleKernelEpoch != epoch)
+	{
+		lotStyleKernel = SelectLotStyleKernel(StyleContext::Get().wallToWallOption);
+		lotStyleKernelEpoch = epoch;
+
+		LotConfigurationStyleIndex& index = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+		index.SetActiveStyles(GetStylesInUse(pThis));
+		index.UpdateStyleMasks(spBuildingSelectWinManager->GetBuildingStyleIndex());
+	}
+
+	const std::optional<uint32_t> styleSetID = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex().GetStyleSetID(
+		&pLotConfiguration->buildingOccupantGroups);
+
+	bool result = false;
+
+	if (spPreferences->LogLotStyleSelection())
+	{
+		// The cache is bypassed when logging is enabled, this ensures that
+		// every check writes its success/failure log messages.
+		result = lotStyleKernel(pThis, pLotConfiguration, purpose, styleSetID);
+	}
+	else
+	{
+		if (styleSetID.has_value())
+		{
+			if (LotMayContainActiveStyle(pLotConfiguration, purpose, styleSetID.value()))
+			{
+				result = CheckLotCompatibilityUsingCache(
+					lotStyleSetCompatibilityCache,
+					styleSetID.value(),
+					pThis,
+					pLotConfiguration,
+					purpose,
+					styleSetID,
+					epoch);
+			}
+			else
+			{
+				// Most of the possible lot configurations are rejected here when only
+				// a few of the installed styles are active.
+				result = false;
+			}
+		}
+		else
+		{
+			// The lot configuration was not seen by the GetBuildingStyles hook.
+			result = CheckLotCompatibilityUsingCache(
+				lotStyleCompatibilityCache,
+				pLotConfiguration->id,
+				pThis,
+				pLotConfiguration,
+				purpose,
+				std::nullopt,
+				epoch);
+		}
+	}
+
+	if (styleSelectionTrace.IsOpen())
+	{
+		const SC4Vector<uint32_t>& buildingOccupantGroups = pLotConfiguration->buildingOccupantGroups;
+
+		TraceStyleSelectionContext(pThis, epoch);
+		styleSelectionTrace.WriteLotCheck(
+			pLotConfiguration->id,
+			std::span<const uint32_t>(buildingOccupantGroups.begin(), buildingOccupantGroups.size()),
+			static_cast<uint32_t>(purpose),
+			result);
 	}
+
+	return result;
+}
+
+static bool IsLotConfigurationStyleCompatible(
+	const cSC4TractDeveloper* pThis,
+	const cSC4LotConfiguration* pLotConfiguration,
+	cISC4BuildingOccupant::PurposeType purpose)
+{
+	return MeasureHookCall(isLotConfigurationSuitableStatistics, [&]()
+	{
+		// If building styles are not supported report that the style is compatible.
+		return !DoesLotSupportBuildingStyles(pThis, pLotConfiguration, purpose)
+			|| IsLotCompatibleWithActiveStyles(pThis, pLotConfiguration, purpose);
+	});
 }
 
 static void NAKED_FUN IsLotConfigurationSuitable_BuildingStyleSelectionHook()
@@ -570,18 +978,10 @@ static void NAKED_FUN IsLotConfigurationSuitable_BuildingStyleSelectionHook()
 		push ebp // lot purpose type
 		push edi // cISC4LotConfiguration*
 		push esi // cSC4TractDeveloper this pointer
-		call DoesLotSupportBuildingStyles // (cdecl)
-		add esp, 12
-		test al, al
-		jz compatableStyleFound // If building styles are not supported report that the style is compatible
-		push ebp // lot purpose type
-		push edi // cISC4LotConfiguration*
-		push esi // cSC4TractDeveloper this pointer
-		call IsLotCompatibleWithActiveStyles // (cdecl)
+		call IsLotConfigurationStyleCompatible // (cdecl)
 		add esp, 12
 		test al, al
 		jz noCompatableStyleFound
-		compatableStyleFound:
 		pop edx // restore
 		pop ecx // restore
 		pop eax // restore
@@ -618,27 +1018,17 @@ static bool DoesBuildingSupportStyles(
 	return true;
 }
 
+template<IBuildingSelectWinContext::WallToWallOption wallToWallOption>
 static bool CheckAdditionalBuildingStyleOptions(
 	const cSC4TractDeveloper* pThis,
 	uint32_t buildingType,
-	const cISCPropertyHolder* pPropertyHolder)
+	const BuildingStyleRecord& record)
 {
 	bool result = true;
 
-	const IBuildingSelectWinContext& context = spBuildingSelectWinManager->GetContext();
-	const IBuildingSelectWinContext::WallToWallOption wallToWallOption = context.GetWallToWallOption();
-
-	if (wallToWallOption != IBuildingSelectWinContext::WallToWallOption::Mixed)
+	if constexpr (wallToWallOption != IBuildingSelectWinContext::WallToWallOption::Mixed)
 	{
-		switch (wallToWallOption)
-		{
-		case IBuildingSelectWinContext::WallToWallOption::Only:
-			result = BuildingUtil::IsWallToWall(pPropertyHolder);
-			break;
-		case IBuildingSelectWinContext::WallToWallOption::Block:
-			result = !BuildingUtil::IsWallToWall(pPropertyHolder);
-			break;
-		}
+		result = StyleCompatibilityEngine::CheckWallToWallOption(wallToWallOption, record.IsWallToWall());
 
 		if (!result && spPreferences->LogLotStyleSelection())
 		{
@@ -666,80 +1056,75 @@ static void LogBuildingStyleSupported(
 	}
 }
 
-template <bool isBuildingStylesProperty>
+template <bool isBuildingStylesProperty, bool allStylesActive>
 static bool BuildingHasStyleValue(
 	const cSC4TractDeveloper* pThis,
 	uint32_t buildingType,
-	const PropertyData<uint32_t>& propertyData,
+	const BuildingStyleCatalog& catalog,
+	const BuildingStyleRecord& record,
 	cISC4BuildingOccupant::PurposeType purposeType)
 {
-	if (pThis->changeStylesEveryNYears == 0)
+	if (StyleCompatibilityEngine::IsCompatibleWithAllStyles(
+		isBuildingStylesProperty,
+		BuildingUtil::IsIndustrialBuilding(purposeType)))
 	{
-		// Use all styles at once.
+		// Industrial buildings without the Building Styles property are
+		// compatible with all styles.
+		LogBuildingStyleSupported(pThis, buildingType, GetFirstActiveStyle(pThis));
+		return true;
+	}
 
-		const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+	if constexpr (allStylesActive)
+	{
+		// Every style has a catalog index and is active, so any indexed style is a match.
+		const std::optional<uint32_t> index = StyleMask::FindFirstSetBit(catalog.get_style_mask(record));
 
-		for (const auto& style : activeStyles)
+		if (index.has_value())
 		{
-			if constexpr (isBuildingStylesProperty)
+			if (spPreferences->LogBuildingStyleSelection())
 			{
-				if (propertyData.contains(style))
-				{
-					LogBuildingStyleSupported(pThis, buildingType, style);
-					return true;
-				}
-			}
-			else
-			{
-				if (BuildingUtil::IsIndustrialBuilding(purposeType))
-				{
-					// Industrial buildings without the Building Styles property are
-					// compatible with all styles.
-					LogBuildingStyleSupported(pThis, buildingType, style);
-					return true;
-				}
-				else
-				{
-					if (propertyData.contains(style))
-					{
-						LogBuildingStyleSupported(pThis, buildingType, style);
-						return true;
-					}
-				}
+				LogBuildingStyleSupported(
+					pThis,
+					buildingType,
+					GetFirstActiveStyleInList(pThis, catalog.get_styles(record), catalog.GetStyleFromIndex(index.value())));
 			}
+			return true;
 		}
 	}
-	else
+	else if (styleSelectionState.currentRotationStyle.valid)
 	{
-		// Change style every N years.
-
-		uint32_t activeStyle = pThis->activeStyles[pThis->currentStyleIndex];
+		// The catalog records are used to build the rotation style sets, so
+		// a building that is not in the set for the current style isn't a match.
+		const RotationStyleSets& rotationStyle = styleSelectionState.currentRotationStyle;
 
-		if constexpr (isBuildingStylesProperty)
+		if (std::binary_search(rotationStyle.buildingTypes.begin(), rotationStyle.buildingTypes.end(), buildingType))
 		{
-			if (propertyData.contains(activeStyle))
-			{
-				LogBuildingStyleSupported(pThis, buildingType, activeStyle);
-				return true;
-			}
+			LogBuildingStyleSupported(pThis, buildingType, rotationStyle.style);
+			return true;
 		}
-		else
+	}
+	else if (pBuildingCompatibilityTable && !spPreferences->LogBuildingStyleSelection())
+	{
+		// The table does not record the matching style, so it is not used when logging is enabled.
+		if (pBuildingCompatibilityTable->IsCompatible(record))
 		{
-			if (BuildingUtil::IsIndustrialBuilding(purposeType))
-			{
-				// Industrial buildings without the Building Styles property are
-				// compatible with all styles.
-				LogBuildingStyleSupported(pThis, buildingType, activeStyle);
-				return true;
-			}
-			else
+			return true;
+		}
+	}
+	else
+	{
+		uint32_t style = 0;
+
+		if (GetActiveStyleMask(pThis).FindFirstMatch(
+			catalog.get_style_mask(record),
+			catalog.get_styles(record),
+			style))
+		{
+			if (spPreferences->LogBuildingStyleSelection())
 			{
-				if (propertyData.contains(activeStyle))
-				{
-					LogBuildingStyleSupported(pThis, buildingType, activeStyle);
-					return true;
-				}
+				LogBuildingStyleSupported(pThis, buildingType, GetFirstActiveStyleInList(pThis, catalog.get_styles(record), style));
 			}
+			return true;
 		}
 	}
 
@@ -911,13 +1296,13 @@ static void LogCandidateLotInfo(
 
 static std::string PrintBuildingStyles(
 	const BuildingStyleCollection& availableStyles,
-	const PropertyData<uint32_t>& propertyData)
+	std::span<const uint32_t> buildingStyles)
 {
 	std::string result;
 
 	bool firstItem = true;
 
-	for (const uint32_t& item : propertyData)
+	for (const uint32_t& item : buildingStyles)
 	{
 		if (availableStyles.contains_style(item))
 		{
@@ -940,8 +1325,8 @@ static std::string PrintBuildingStyles(
 static void LogStyleMatchInfo(
 	const BuildingStyleCollection& availableStyles,
 	bool result,
-	const PropertyData<uint32_t>& oldBuildingStyles,
-	const PropertyData<uint32_t>& newBuildingStyles)
+	std::span<const uint32_t> oldBuildingStyles,
+	std::span<const uint32_t> newBuildingStyles)
 {
 	if (spPreferences->LogBuildingStyleSelection())
 	{
@@ -958,71 +1343,13 @@ static void LogStyleMatchInfo(
 
 static std::optional<bool> StylesMatch(
 	const BuildingStyleCollection& availableStyles,
-	const PropertyData<uint32_t>& newBuildingStyles,
-	const PropertyData<uint32_t>& oldBuildingStyles)
-{
-	std::optional<bool> result;
-
-	for (const uint32_t& style : newBuildingStyles)
-	{
-		if (availableStyles.contains_style(style))
-		{
-			result = oldBuildingStyles.contains(style);
-
-			if (result.value())
-			{
-				break;
-			}
-		}
-	}
-
-	return result;
-}
-
-static std::optional<bool> StyleMatchesExistingLot(const cISC4Lot* pLot, const PropertyData<uint32_t>& newBuildingStyles)
+	std::span<const uint32_t> newBuildingStyles,
+	std::span<const uint32_t> oldBuildingStyles)
 {
-	std::optional<bool> result;
-
-	if (pLot)
-	{
-		cISC4BuildingOccupant* pBuilding = pLot->GetBuilding();
-
-		if (pBuilding)
-		{
-			cISCPropertyHolder* pPropertyHolder = pBuilding->AsOccupant()->AsPropertyHolder();
-
-			if (pPropertyHolder)
-			{
-				const BuildingStyleCollection& availableStyles = spBuildingSelectWinManager->GetAvailableBuildingStyles();
-
-				PropertyData<uint32_t> oldBuildingStyles;
-
-				if (BuildingStyleUtil::TryReadBuildingStylesProperty(pPropertyHolder, oldBuildingStyles))
-				{
-					result = StylesMatch(availableStyles, newBuildingStyles, oldBuildingStyles);
-
-					if (result.has_value())
-					{
-						LogStyleMatchInfo(availableStyles, result.value(), oldBuildingStyles, newBuildingStyles);
-					}
-				}
-				else
-				{
-					if (oldBuildingStyles.load(pPropertyHolder, kOccupantGroupsProperty))
-					{
-						result = StylesMatch(availableStyles, newBuildingStyles, oldBuildingStyles);
-
-						if (result.has_value())
-						{
-							LogStyleMatchInfo(availableStyles, result.value(), oldBuildingStyles, newBuildingStyles);
-						}
-					}
-				}
-			}
-		}
-	}
-
-	return result;
+	return StyleCompatibilityEngine::StylesMatch(
+		newBuildingStyles,
+		oldBuildingStyles,
+		[&](uint32_t style) { return availableStyles.contains_style(style); });
 }
 
 static LotZoningOptions GetLotZoningOptionsForPurposeType(cISC4BuildingOccupant::PurposeType purposeType)
@@ -1041,7 +1368,7 @@ static LotZoningOptions GetLotZoningOptionsForPurposeType(cISC4BuildingOccupant:
 	case cISC4BuildingOccupant::PurposeType::Residence:
 	case cISC4BuildingOccupant::PurposeType::Services:
 	case cISC4BuildingOccupant::PurposeType::Office:
-		result = spBuildingSelectWinManager->GetContext().GetLotZoningOptions();
+		result = StyleContext::Get().lotZoningOptions;
 		break;
 	}
 
@@ -1067,102 +1394,421 @@ static bool CandidateLotMatchesZoningOptions(
 	return result;
 }
 
-static bool BuildingHasStyleOccupantGroup(
+// The game tests every building type that can fit on a candidate lot before moving on to
+// the next candidate, so the values that only depend on the candidate lot are computed once
+// and reused for each building type.
+struct CandidateLotEvaluationContext
+{
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot = nullptr;
+	const cISC4Lot* pExistingLot = nullptr;
+	cISC4BuildingOccupant* pExistingBuilding = nullptr;
+	uint32_t existingBuildingType = 0;
+	cSC4TractDeveloper::CandidateLot::DevelopmentType developmentType = cSC4TractDeveloper::CandidateLot::DevelopmentType::LotSameSize;
+	cISC4BuildingOccupant::PurposeType purpose = cISC4BuildingOccupant::PurposeType::None;
+	uint32_t epoch = 0;
+	bool matchesZoningOptions = false;
+	bool existingBuildingStylesResolved = false;
+	bool hasExistingBuildingStyles = false;
+	std::vector<uint32_t> existingBuildingStyles;
+};
+
+static CandidateLotEvaluationContext candidateLotEvaluationContext;
+static RedevelopmentStyleMatchCache redevelopmentStyleMatchCache;
+
+static CandidateLotEvaluationContext& GetCandidateLotEvaluationContext(
+	const cSC4TractDeveloper* pThis,
+	cISC4BuildingOccupant::PurposeType purpose,
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot)
+{
+	CandidateLotEvaluationContext& context = candidateLotEvaluationContext;
+
+	const uint32_t epoch = GetStyleSelectionEpoch(pThis);
+	const cISC4Lot* pExistingLot = pCandidateLot->pExistingLot;
+	cISC4BuildingOccupant* pExistingBuilding = pExistingLot ? pExistingLot->GetBuilding() : nullptr;
+
+	// The game reuses the candidate lot memory, so the existing lot and building are also
+	// checked to detect when a different lot is being evaluated.
+	if (context.pCandidateLot != pCandidateLot
+		|| context.pExistingLot != pExistingLot
+		|| context.pExistingBuilding != pExistingBuilding
+		|| context.developmentType != pCandidateLot->developmentType
+		|| context.purpose != purpose
+		|| context.epoch != epoch)
+	{
+		context.pCandidateLot = pCandidateLot;
+		context.pExistingLot = pExistingLot;
+		context.pExistingBuilding = pExistingBuilding;
+		context.existingBuildingType = pExistingBuilding ? pExistingBuilding->GetBuildingType() : 0;
+		context.developmentType = pCandidateLot->developmentType;
+		context.purpose = purpose;
+		context.epoch = epoch;
+		context.matchesZoningOptions = CandidateLotMatchesZoningOptions(purpose, pCandidateLot);
+		context.existingBuildingStylesResolved = false;
+		context.hasExistingBuildingStyles = false;
+		context.existingBuildingStyles.clear();
+	}
+
+	return context;
+}
+
+static void ResolveExistingBuildingStyles(CandidateLotEvaluationContext& context)
+{
+	if (!context.existingBuildingStylesResolved)
+	{
+		context.existingBuildingStylesResolved = true;
+
+		if (context.pExistingBuilding)
+		{
+			cISCPropertyHolder* pPropertyHolder = context.pExistingBuilding->AsOccupant()->AsPropertyHolder();
+
+			if (pPropertyHolder)
+			{
+				const BuildingStyleUtil::BuildingStyleProperties properties = BuildingStyleUtil::ReadBuildingStyleProperties(pPropertyHolder);
+				const std::span<const uint32_t> oldBuildingStyles = properties.GetStyles();
+
+				if (!oldBuildingStyles.empty())
+				{
+					context.existingBuildingStyles.assign(oldBuildingStyles.begin(), oldBuildingStyles.end());
+					context.hasExistingBuildingStyles = true;
+				}
+			}
+		}
+	}
+}
+
+static std::optional<bool> StyleMatchesExistingLot(
+	CandidateLotEvaluationContext& context,
+	uint32_t newBuildingType,
+	std::span<const uint32_t> newBuildingStyles)
+{
+	std::optional<bool> result;
+
+	if (!context.pExistingBuilding)
+	{
+		return result;
+	}
+
+	// The cache is bypassed when logging is enabled, this ensures that
+	// every check writes its log messages.
+	const bool useCache = !spPreferences->LogBuildingStyleSelection();
+
+	if (useCache && redevelopmentStyleMatchCache.find(context.existingBuildingType, newBuildingType, result))
+	{
+		return result;
+	}
+
+	ResolveExistingBuildingStyles(context);
+
+	if (context.hasExistingBuildingStyles)
+	{
+		const BuildingStyleCollection& availableStyles = spBuildingSelectWinManager->GetAvailableBuildingStyles();
+
+		result = StylesMatch(availableStyles, newBuildingStyles, context.existingBuildingStyles);
+
+		if (result.has_value())
+		{
+			LogStyleMatchInfo(availableStyles, result.value(), context.existingBuildingStyles, newBuildingStyles);
+		}
+	}
+
+	if (useCache)
+	{
+		redevelopmentStyleMatchCache.insert(context.existingBuildingType, newBuildingType, result);
+	}
+
+	return result;
+}
+
+typedef bool(*pfn_BuildingStyleKernel)(
+	const cSC4TractDeveloper* pThis,
+	uint32_t buildingType,
+	cISC4BuildingOccupant::PurposeType purpose,
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot);
+
+// The building style check is specialized for the current Building Style Control
+// options, this removes the per-building branches for options that are not in use.
+template <
+	IBuildingSelectWinContext::WallToWallOption wallToWallOption,
+	bool checkLotZoningOptions,
+	bool preventCrossStyleRedevelopment,
+	bool allStylesActive>
+static bool BuildingStyleKernel(
 	const cSC4TractDeveloper* pThis,
 	uint32_t buildingType,
 	cISC4BuildingOccupant::PurposeType purpose,
 	const cSC4TractDeveloper::CandidateLot* pCandidateLot)
 {
-	if (!CandidateLotMatchesZoningOptions(purpose, pCandidateLot))
+	CandidateLotEvaluationContext* pCandidateContext = nullptr;
+
+	if constexpr (checkLotZoningOptions || preventCrossStyleRedevelopment)
 	{
-		// The game selected a lot that uses aggregation or subdivision when the user has it disabled.
-		// While in theory this should be handled by Grow_LotAggregationAndSubdivisionHook, there are
-		// cases where the game somehow bypasses that code.
+		pCandidateContext = &GetCandidateLotEvaluationContext(pThis, purpose, pCandidateLot);
+	}
 
-		if (spPreferences->LogCandidateLots())
+	if constexpr (checkLotZoningOptions)
+	{
+		if (!pCandidateContext->matchesZoningOptions)
 		{
-			Logger::GetInstance().Write(
-				LogLevel::Info,
-				"Rejected due to the development type being disabled by the user: ");
-			// Finish the line with the candidate info.
-			LogCandidateLotInfo(pThis, pCandidateLot);
+			// The game selected a lot that uses aggregation or subdivision when the user has it disabled.
+			// While in theory this should be handled by Grow_LotAggregationAndSubdivisionHook, there are
+			// cases where the game somehow bypasses that code.
+
+			if (spPreferences->LogCandidateLots())
+			{
+				Logger::GetInstance().Write(
+					LogLevel::Info,
+					"Rejected due to the development type being disabled by the user: ");
+				// Finish the line with the candidate info.
+				LogCandidateLotInfo(pThis, pCandidateLot);
+			}
+
+			return false;
 		}
+	}
+
+	LogCandidateLotInfo(pThis, pCandidateLot);
+
+	const BuildingStyleCatalog& catalog = spBuildingSelectWinManager->GetBuildingStyleCatalog();
+	const BuildingStyleRecord* pRecord = catalog.find(buildingType);
 
+	if (!pRecord)
+	{
 		return false;
 	}
 
-	LogCandidateLotInfo(pThis, pCandidateLot);
+	// CheckAdditionalBuildingStyleOptions will write a log message if it fails.
+	if (!CheckAdditionalBuildingStyleOptions<wallToWallOption>(pThis, buildingType, *pRecord))
+	{
+		return false;
+	}
 
-	bool result = false;
+	const std::span<const uint32_t> buildingStyles = catalog.get_styles(*pRecord);
 
-	cGZPersistResourceKey key;
+	if (buildingStyles.empty())
+	{
+		return false;
+	}
 
-	if (pThis->pBuildingDevelopmentSim->GetBuildingKeyFromType(buildingType, key))
+	bool result = false;
+
+	if (pRecord->HasBuildingStylesProperty())
 	{
-		cIGZPersistResourceManagerPtr pRM;
+		result = BuildingHasStyleValue<true, allStylesActive>(
+			pThis,
+			buildingType,
+			catalog,
+			*pRecord,
+			purpose);
+	}
+	else
+	{
+		result = BuildingHasStyleValue<false, allStylesActive>(
+			pThis,
+			buildingType,
+			catalog,
+			*pRecord,
+			purpose);
+	}
 
-		if (pRM)
+	if constexpr (preventCrossStyleRedevelopment)
+	{
+		if (result)
 		{
-			cRZAutoRefCount<cISCPropertyHolder> pPropertyHolder;
+			std::optional<bool> styleMatches = StyleMatchesExistingLot(
+				*pCandidateContext,
+				buildingType,
+				buildingStyles);
 
-			if (pRM->GetResource(key, GZIID_cISCPropertyHolder, pPropertyHolder.AsPPVoid(), 0, nullptr))
+			if (styleMatches.has_value())
 			{
-				// CheckAdditionalBuildingStyleOptions will write a log message if it fails.
-				if (CheckAdditionalBuildingStyleOptions(pThis, buildingType, pPropertyHolder))
-				{
-					PropertyData<uint32_t> propertyData;
+				result = styleMatches.value();
+			}
+		}
+	}
 
-					if (BuildingStyleUtil::TryReadBuildingStylesProperty(pPropertyHolder, propertyData))
-					{
-						result = BuildingHasStyleValue<true>(
-							pThis,
-							buildingType,
-							propertyData,
-							purpose);
-
-						if (result && spBuildingSelectWinManager->GetContext().PreventCrossStyleRedevelopment())
-						{
-							std::optional<bool> styleMatches = StyleMatchesExistingLot(
-								pCandidateLot->pExistingLot,
-								propertyData);
-
-							if (styleMatches.has_value())
-							{
-								result = styleMatches.value();
-							}
-						}
-					}
-					else
-					{
-						if (propertyData.load(pPropertyHolder, kOccupantGroupsProperty))
-						{
-							result = BuildingHasStyleValue<false>(
-								pThis,
-								buildingType,
-								propertyData,
-								purpose);
-
-							if (result && spBuildingSelectWinManager->GetContext().PreventCrossStyleRedevelopment())
-							{
-								std::optional<bool> styleMatches = StyleMatchesExistingLot(
-									pCandidateLot->pExistingLot,
-									propertyData);
-
-								if (styleMatches.has_value())
-								{
-									result = styleMatches.value();
-								}
-							}
-						}
-					}
-				}
+	return result;
+}
+
+template <
+	IBuildingSelectWinContext::WallToWallOption wallToWallOption,
+	bool checkLotZoningOptions,
+	bool preventCrossStyleRedevelopment>
+static pfn_BuildingStyleKernel SelectBuildingStyleKernel(bool allStylesActive)
+{
+	if (allStylesActive)
+	{
+		return &BuildingStyleKernel<wallToWallOption, checkLotZoningOptions, preventCrossStyleRedevelopment, true>;
+	}
+	else
+	{
+		return &BuildingStyleKernel<wallToWallOption, checkLotZoningOptions, preventCrossStyleRedevelopment, false>;
+	}
+}
+
+template <IBuildingSelectWinContext::WallToWallOption wallToWallOption, bool checkLotZoningOptions>
+static pfn_BuildingStyleKernel SelectBuildingStyleKernel(bool preventCrossStyleRedevelopment, bool allStylesActive)
+{
+	if (preventCrossStyleRedevelopment)
+	{
+		return SelectBuildingStyleKernel<wallToWallOption, checkLotZoningOptions, true>(allStylesActive);
+	}
+	else
+	{
+		return SelectBuildingStyleKernel<wallToWallOption, checkLotZoningOptions, false>(allStylesActive);
+	}
+}
+
+template <IBuildingSelectWinContext::WallToWallOption wallToWallOption>
+static pfn_BuildingStyleKernel SelectBuildingStyleKernel(
+	bool checkLotZoningOptions,
+	bool preventCrossStyleRedevelopment,
+	bool allStylesActive)
+{
+	if (checkLotZoningOptions)
+	{
+		return SelectBuildingStyleKernel<wallToWallOption, true>(preventCrossStyleRedevelopment, allStylesActive);
+	}
+	else
+	{
+		return SelectBuildingStyleKernel<wallToWallOption, false>(preventCrossStyleRedevelopment, allStylesActive);
+	}
+}
+
+static pfn_BuildingStyleKernel SelectBuildingStyleKernel(
+	const StyleContextSnapshot& snapshot,
+	const StyleSelectionState& state)
+{
+	// Lot aggregation and subdivision are always allowed when the user hasn't disabled them.
+	const bool checkLotZoningOptions = snapshot.lotZoningOptions != LotZoningOptionNone;
+	const bool preventCrossStyleRedevelopment = snapshot.preventCrossStyleRedevelopment;
+	const bool allStylesActive = state.activeStyleMask.AreAllStylesActive();
+
+	switch (snapshot.wallToWallOption)
+	{
+	case IBuildingSelectWinContext::WallToWallOption::Only:
+		return SelectBuildingStyleKernel<IBuildingSelectWinContext::WallToWallOption::Only>(
+			checkLotZoningOptions,
+			preventCrossStyleRedevelopment,
+			allStylesActive);
+	case IBuildingSelectWinContext::WallToWallOption::Block:
+		return SelectBuildingStyleKernel<IBuildingSelectWinContext::WallToWallOption::Block>(
+			checkLotZoningOptions,
+			preventCrossStyleRedevelopment,
+			allStylesActive);
+	case IBuildingSelectWinContext::WallToWallOption::Mixed:
+	default:
+		return SelectBuildingStyleKernel<IBuildingSelectWinContext::WallToWallOption::Mixed>(
+			checkLotZoningOptions,
+			preventCrossStyleRedevelopment,
+			allStylesActive);
+	}
+}
+
+static void TraceBuildingCheck(
+	const cSC4TractDeveloper* pThis,
+	uint32_t epoch,
+	uint32_t buildingType,
+	cISC4BuildingOccupant::PurposeType purpose,
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot,
+	bool result)
+{
+	const BuildingStyleCatalog& catalog = spBuildingSelectWinManager->GetBuildingStyleCatalog();
+	const BuildingStyleRecord* pRecord = catalog.find(buildingType);
+
+	StyleSelectionTrace::CandidateLotInfo candidateLot{};
+	candidateLot.developmentType = static_cast<uint8_t>(pCandidateLot->developmentType);
+	candidateLot.lotLocationX = pCandidateLot->lotLocationX;
+	candidateLot.lotLocationZ = pCandidateLot->lotLocationZ;
+	candidateLot.lotSizeX = pCandidateLot->lotSizeX;
+	candidateLot.lotSizeZ = pCandidateLot->lotSizeZ;
+	candidateLot.facing = static_cast<uint8_t>(pCandidateLot->facing);
+
+	BuildingStyleUtil::BuildingStyleProperties existingBuildingProperties;
+
+	if (pCandidateLot->pExistingLot)
+	{
+		cISC4BuildingOccupant* pExistingBuilding = pCandidateLot->pExistingLot->GetBuilding();
+
+		if (pExistingBuilding)
+		{
+			candidateLot.existingBuildingType = pExistingBuilding->GetBuildingType();
+
+			cISCPropertyHolder* pPropertyHolder = pExistingBuilding->AsOccupant()->AsPropertyHolder();
+
+			if (pPropertyHolder)
+			{
+				existingBuildingProperties = BuildingStyleUtil::ReadBuildingStyleProperties(pPropertyHolder);
 			}
 		}
 	}
 
+	TraceStyleSelectionContext(pThis, epoch);
+	styleSelectionTrace.WriteBuildingCheck(
+		buildingType,
+		pRecord ? pRecord->flags : BuildingStyleRecord::FlagNone,
+		pRecord ? catalog.get_styles(*pRecord) : std::span<const uint32_t>(),
+		static_cast<uint32_t>(purpose),
+		candidateLot,
+		existingBuildingProperties.GetStyles(),
+		result);
+}
+
+static pfn_BuildingStyleKernel buildingStyleKernel = nullptr;
+static uint32_t buildingStyleKernelEpoch = 0;
+
+static bool BuildingHasStyleOccupantGroup(
+	const cSC4TractDeveloper* pThis,
+	uint32_t buildingType,
+	cISC4BuildingOccupant::PurposeType purpose,
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot)
+{
+	const uint32_t epoch = GetStyleSelectionEpoch(pThis);
+
+	if (!buildingStyleKernel || buildingStyleKernelEpoch != epoch)
+	{
+		buildingStyleKernel = SelectBuildingStyleKernel(StyleContext::Get(), styleSelectionState);
+		buildingStyleKernelEpoch = epoch;
+
+		const BuildingStyleCatalog& catalog = spBuildingSelectWinManager->GetBuildingStyleCatalog();
+
+		// The table is only used when some of the styles are active and the game
+		// is not set to change styles every N years, the other modes have their
+		// own precomputed sets.
+		if (catalog.size() > 0
+			&& !styleSelectionState.activeStyleMask.AreAllStylesActive()
+			&& !styleSelectionState.currentRotationStyle.valid)
+		{
+			buildingCompatibilityTableBuilder.Rebuild(StyleContext::Acquire(), catalog);
+		}
+	}
+
+	// The style checks are performed inline until the worker threads have built the table.
+	pBuildingCompatibilityTable = buildingCompatibilityTableBuilder.GetTable(epoch);
+
+	const bool result = buildingStyleKernel(pThis, buildingType, purpose, pCandidateLot);
+
+	if (styleSelectionTrace.IsOpen())
+	{
+		TraceBuildingCheck(pThis, epoch, buildingType, purpose, pCandidateLot, result);
+	}
+
 	return result;
 }
 
+static bool IsBuildingStyleCompatible(
+	const cSC4TractDeveloper* pThis,
+	uint32_t buildingType,
+	cISC4BuildingOccupant::PurposeType purpose,
+	const cSC4TractDeveloper::CandidateLot* pCandidateLot)
+{
+	return MeasureHookCall(isBuildingCompatibleStatistics, [&]()
+	{
+		// If building styles are not supported report that the style is compatible.
+		return !DoesBuildingSupportStyles(pThis, buildingType, purpose)
+			|| BuildingHasStyleOccupantGroup(pThis, buildingType, purpose, pCandidateLot);
+	});
+}
+
 static uintptr_t IsBuildingCompatible_CompatableStyleFound_Continue;
 static uintptr_t IsBuildingCompatible_NoCompatableStyle_Continue;
 
@@ -1178,25 +1824,16 @@ static void NAKED_FUN IsBuildingCompatible_BuildingStyleSelectionHook()
 		push eax // store
 		push ecx // store
 		push edx // store
-		mov eax, dword ptr[edi]
-		push eax // purpose
-		push ebp // building type
-		push esi // this pointer
-		call DoesBuildingSupportStyles // (cdecl)
-		add esp, 12
-		test al, al
-		jz compatableStyleFound // If building styles are not supported report that the style is compatible
 		mov ecx, dword ptr[esp - 0xc + 0x10 + 0x3c]
 		push ecx // CandidateLot pointer
 		mov eax, dword ptr[edi]
 		push eax // purpose
 		push ebp // building type
 		push esi // this pointer
-		call BuildingHasStyleOccupantGroup
+		call IsBuildingStyleCompatible // (cdecl)
 		add esp, 16
 		test al, al
 		jz noCompatableStyleFound
-		compatableStyleFound:
 		pop edx // restore
 		pop ecx // restore
 		pop eax // restore
@@ -1227,7 +1864,7 @@ static bool __fastcall DisableLotSubdivisionForPurposeType(cISC4BuildingOccupant
 	case cISC4BuildingOccupant::PurposeType::Residence:
 	case cISC4BuildingOccupant::PurposeType::Services:
 	case cISC4BuildingOccupant::PurposeType::Office:
-		result = (spBuildingSelectWinManager->GetContext().GetLotZoningOptions() & LotZoningOptionDisableSubdivision) != 0;
+		result = (StyleContext::Get().lotZoningOptions & LotZoningOptionDisableSubdivision) != 0;
 		break;
 	case cISC4BuildingOccupant::PurposeType::Agriculture:
 		// Agriculture lots don't support subdivision.
@@ -1247,7 +1884,9 @@ static uintptr_t Grow_LotAggregationAndSubdivisionHook_Continue;
 
 static int32_t __fastcall ListCandidateLots_Aggregation_Proxy(cSC4TractDeveloper* pThis, void* edxUnused)
 {
-	int32_t result = ListCandidateLots_Aggregation(pThis);
+	int32_t result = MeasureHookCall(
+		listCandidateLotsAggregationStatistics,
+		[&]() { return ListCandidateLots_Aggregation(pThis); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1259,7 +1898,9 @@ static int32_t __fastcall ListCandidateLots_Aggregation_Proxy(cSC4TractDeveloper
 
 static int32_t __fastcall ListCandidateLots_Subdivision_Proxy(cSC4TractDeveloper* pThis, void* edxUnused)
 {
-	int32_t result = ListCandidateLots_Subdivision(pThis);
+	int32_t result = MeasureHookCall(
+		listCandidateLotsSubdivisionStatistics,
+		[&]() { return ListCandidateLots_Subdivision(pThis); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1314,7 +1955,9 @@ pfn_Build_Functions BuildFarm = nullptr;
 
 static int32_t __fastcall TakeOverAbandoned_Trampoline(cSC4TractDeveloper* pThis, void* edxUnused)
 {
-	int32_t result = TakeOverAbandoned(pThis);
+	int32_t result = MeasureHookCall(
+		takeOverAbandonedStatistics,
+		[&]() { return TakeOverAbandoned(pThis); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1326,7 +1969,9 @@ static int32_t __fastcall TakeOverAbandoned_Trampoline(cSC4TractDeveloper* pThis
 
 static int32_t __fastcall ListPossibleLotConfigurations_Trampoline(cSC4TractDeveloper* pThis, void* edxUnused)
 {
-	int32_t result = ListPossibleLotConfigurations(pThis);
+	int32_t result = MeasureHookCall(
+		listPossibleLotConfigurationsStatistics,
+		[&]() { return ListPossibleLotConfigurations(pThis); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1338,7 +1983,9 @@ static int32_t __fastcall ListPossibleLotConfigurations_Trampoline(cSC4TractDeve
 
 static int32_t __fastcall ListCandidateLots_Existing_Trampoline(cSC4TractDeveloper* pThis, void* edxUnused)
 {
-	int32_t result = ListCandidateLots_Existing(pThis);
+	int32_t result = MeasureHookCall(
+		listCandidateLotsExistingStatistics,
+		[&]() { return ListCandidateLots_Existing(pThis); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1350,7 +1997,9 @@ static int32_t __fastcall ListCandidateLots_Existing_Trampoline(cSC4TractDevelop
 
 static int32_t __fastcall Build_Trampoline(cSC4TractDeveloper* pThis, void* edxUnused, void* candidateLot)
 {
-	int32_t result = Build(pThis, candidateLot);
+	int32_t result = MeasureHookCall(
+		buildStatistics,
+		[&]() { return Build(pThis, candidateLot); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1362,7 +2011,9 @@ static int32_t __fastcall Build_Trampoline(cSC4TractDeveloper* pThis, void* edxU
 
 static int32_t __fastcall BuildFarm_Trampoline(cSC4TractDeveloper* pThis, void* edxUnused, void* candidateLot)
 {
-	int32_t result = BuildFarm(pThis, candidateLot);
+	int32_t result = MeasureHookCall(
+		buildFarmStatistics,
+		[&]() { return BuildFarm(pThis, candidateLot); });
 
 	if (spPreferences->LogGrowableFunctions())
 	{
@@ -1392,6 +2043,223 @@ void TractDeveloperHooks::SetKickOutLowerWealthValue(cISC4TractDeveloper* pTract
 	}
 }
 
+void TractDeveloperHooks::ActiveStylesChanged()
+{
+	styleSelectionState.activeStylesDirty = true;
+	// The rotation style sets are rebuilt with the active style mask.
+	styleSelectionState.currentRotationStyle = RotationStyleSets();
+	styleSelectionState.nextRotationStyle = RotationStyleSets();
+}
+
+void TractDeveloperHooks::ActiveStyleToggled(const cISC4TractDeveloper* pTractDeveloper, uint32_t style, bool isActive)
+{
+	StyleSelectionState& state = styleSelectionState;
+	const cSC4TractDeveloper* pThis = reinterpret_cast<const cSC4TractDeveloper*>(pTractDeveloper);
+
+	if (!pThis)
+	{
+		state.activeStylesDirty = true;
+		return;
+	}
+
+	const SC4Vector<uint32_t>& activeStyles = pThis->activeStyles;
+	const size_t styleCount = static_cast<size_t>(std::count(activeStyles.begin(), activeStyles.end(), style));
+	const size_t previousActiveStyleCount = isActive ? activeStyles.size() - 1 : activeStyles.size() + 1;
+
+	// The full update is used when the state was not current before the style
+	// was toggled, when the style is listed more than once, and when the game is
+	// set to change styles every N years because only the current style is in use.
+	if (state.activeStylesDirty
+		|| state.activeStyleCount != previousActiveStyleCount
+		|| styleCount != (isActive ? 1 : 0)
+		|| pThis->changeStylesEveryNYears != 0
+		|| state.changeStylesEveryNYears != 0)
+	{
+		state.activeStylesDirty = true;
+		return;
+	}
+
+	if (isActive)
+	{
+		state.activeStyleMask.AddStyle(style);
+	}
+	else
+	{
+		state.activeStyleMask.RemoveStyle(style);
+	}
+
+	state.pActiveStyles = activeStyles.begin();
+	state.activeStyleCount = activeStyles.size();
+	state.currentStyleIndex = pThis->currentStyleIndex;
+
+	const uint32_t previousEpoch = StyleContext::Get().epoch;
+	const uint32_t epoch = PublishActiveStyles(pThis);
+
+	// Only the style sets that contain the toggled style can change their result, the
+	// other cached lot results are kept. The results cached by lot configuration id are
+	// discarded by the epoch change, the hook did not see those lot configurations.
+	LotConfigurationStyleIndex& index = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+
+	if (lotStyleKernel
+		&& lotStyleKernelEpoch == previousEpoch
+		&& index.UpdateActiveStyle(style, isActive))
+	{
+		lotStyleSetCompatibilityCache.rebase(previousEpoch, epoch, index.GetStyleSetsWithValue(style));
+		lotStyleKernelEpoch = epoch;
+	}
+}
+
+void TractDeveloperHooks::FlushStyleSelectionTrace()
+{
+	styleSelectionTrace.Flush();
+}
+
+void TractDeveloperHooks::AvailableStylesChanged()
+{
+	redevelopmentStyleMatchCache.clear();
+	// The style indexes that the cached results use may have changed.
+	StyleContext::Publish(StyleContext::Get());
+}
+
+static void WriteCacheStatistics(const char* const cacheName, uint64_t hitCount, uint64_t missCount)
+{
+	const uint64_t totalCount = hitCount + missCount;
+
+	Logger::GetInstance().WriteLineFormatted(
+		LogLevel::Info,
+		"%s: %llu hits, %llu misses, %.1f%% hit rate.",
+		cacheName,
+		hitCount,
+		missCount,
+		totalCount > 0 ? (static_cast<double>(hitCount) * 100.0) / static_cast<double>(totalCount) : 0.0);
+}
+
+void TractDeveloperHooks::WriteStyleSelectionStatistics()
+{
+	WriteCacheStatistics(
+		"Lot style compatibility cache",
+		lotStyleCompatibilityCache.GetHitCount(),
+		lotStyleCompatibilityCache.GetMissCount());
+	WriteCacheStatistics(
+		"Lot style set compatibility cache",
+		lotStyleSetCompatibilityCache.GetHitCount(),
+		lotStyleSetCompatibilityCache.GetMissCount());
+	WriteCacheStatistics(
+		"Redevelopment style match cache",
+		redevelopmentStyleMatchCache.GetHitCount(),
+		redevelopmentStyleMatchCache.GetMissCount());
+
+	const LotConfigurationStyleIndex& lotConfigurationStyleIndex = LotConfigurationManagerHooks::GetLotConfigurationStyleIndex();
+
+	Logger::GetInstance().WriteLineFormatted(
+		LogLevel::Info,
+		"Lot style prefilter: %llu per-entry lot configuration checks rejected, %u distinct style sets with %u values.",
+		lotConfigurationStyleIndex.GetRejectedCount(),
+		static_cast<uint32_t>(lotConfigurationStyleIndex.GetStyleSets().size()),
+		static_cast<uint32_t>(lotConfigurationStyleIndex.GetStyleSets().GetValueCount()));
+}
+
+std::span<const HookStatistics* const> TractDeveloperHooks::GetHookStatistics()
+{
+	return allHookStatistics;
+}
+
+static std::string GetHookStatisticsBucketRange(size_t bucket)
+{
+	if (bucket == 0)
+	{
+		return "0";
+	}
+	else if (bucket == (HookStatistics::BucketCount - 1))
+	{
+		return std::format(">= {}", 1ULL << (bucket - 1));
+	}
+
+	return std::format("{}-{}", 1ULL << (bucket - 1), (1ULL << bucket) - 1);
+}
+
+void TractDeveloperHooks::WriteBuildingCompatibilityTableStatus()
+{
+	const BuildingCompatibilityTableBuilder::Status status = buildingCompatibilityTableBuilder.GetStatus();
+
+	Logger& logger = Logger::GetInstance();
+
+	if (status.chunkCount == 0)
+	{
+		logger.WriteLine(LogLevel::Info, "The building compatibility table has not been built.");
+	}
+	else if (status.ready)
+	{
+		logger.WriteLineFormatted(
+			LogLevel::Info,
+			"The building compatibility table is ready for epoch %u (%u worker threads).",
+			status.epoch,
+			status.workerCount);
+	}
+	else
+	{
+		logger.WriteLineFormatted(
+			LogLevel::Info,
+			"The building compatibility table is being rebuilt for epoch %u, %u of %u chunks complete (%u worker threads).",
+			status.epoch,
+			status.completedChunks,
+			status.chunkCount,
+			status.workerCount);
+	}
+}
+
+void TractDeveloperHooks::Shutdown()
+{
+	buildingCompatibilityTableBuilder.Shutdown();
+}
+
+void TractDeveloperHooks::WriteHookStatistics()
+{
+	Logger& logger = Logger::GetInstance();
+
+	if (!hookStatisticsEnabled)
+	{
+		logger.WriteLine(
+			LogLevel::Info,
+			"The hook statistics are disabled, set HookStatistics=true in SC4MoreBuildingStyles.ini to enable them.");
+		return;
+	}
+
+	logger.WriteLineFormatted(
+		LogLevel::Info,
+		"The style list searches use %s.",
+		StyleListSearch::GetInstructionSetName());
+
+	for (const HookStatistics* pStatistics : allHookStatistics)
+	{
+		const uint64_t callCount = pStatistics->GetCallCount();
+		const uint64_t totalTicks = pStatistics->GetTotalTicks();
+
+		logger.WriteLineFormatted(
+			LogLevel::Info,
+			"%s: %llu calls, %llu ticks total, %llu ticks average, %llu ticks max.",
+			pStatistics->GetName(),
+			callCount,
+			totalTicks,
+			callCount > 0 ? totalTicks / callCount : 0,
+			pStatistics->GetMaxTicks());
+
+		const auto& buckets = pStatistics->GetBuckets();
+
+		for (size_t i = 0; i < buckets.size(); i++)
+		{
+			if (buckets[i] > 0)
+			{
+				logger.WriteLineFormatted(
+					LogLevel::Info,
+					"  %s ticks: %llu",
+					GetHookStatisticsBucketRange(i).c_str(),
+					buckets[i]);
+			}
+		}
+	}
+}
+
 void TractDeveloperHooks::Install(const Preferences& preferences)
 {
 	Logger& logger = Logger::GetInstance();
@@ -1461,7 +2329,7 @@ void TractDeveloperHooks::Install(const Preferences& preferences)
 				Grow_LotAggregationAndSubdivisionHook_Inject,
 				&Grow_LotAggregationAndSubdivisionHook);
 
-			if (preferences.LogGrowableFunctions())
+			if (preferences.LogGrowableFunctions() || preferences.CollectHookStatistics())
 			{
 				Patcher::InstallCallHook(
 					TakeOverAbandoned_Trampoline_Inject,
@@ -1481,6 +2349,16 @@ void TractDeveloperHooks::Install(const Preferences& preferences)
 			}
 
 			logger.WriteLine(LogLevel::Info, "Installed the building style algorithm patch.");
+
+			hookStatisticsEnabled = preferences.CollectHookStatistics();
+
+			if (preferences.TraceStyleSelection())
+			{
+				if (styleSelectionTrace.Open(FileSystem::GetStyleSelectionTraceFilePath()))
+				{
+					logger.WriteLine(LogLevel::Info, "Started the style selection trace.");
+				}
+			}
 		}
 		catch (const wil::ResultException& e)
 		{
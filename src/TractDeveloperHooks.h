@@ -20,8 +20,11 @@
  */
 
 #pragma once
+#include <cstdint>
+#include <span>
 
 class cISC4TractDeveloper;
+class HookStatistics;
 class Preferences;
 
 namespace TractDeveloperHooks
@@ -29,5 +32,35 @@ namespace TractDeveloperHooks
 	bool GetKickOutLowerWealthValue(const cISC4TractDeveloper* pTractDeveloper);
 	void SetKickOutLowerWealthValue(cISC4TractDeveloper* pTractDeveloper, bool value);
 
+	// Notifies the growth hooks that the tract developer's active style list was modified.
+	void ActiveStylesChanged();
+
+	// Notifies the growth hooks that a single style was added to or removed from the
+	// tract developer's active style list, only the results that depend on that style
+	// are recomputed.
+	void ActiveStyleToggled(const cISC4TractDeveloper* pTractDeveloper, uint32_t style, bool isActive);
+
+	// Notifies the growth hooks that the list of available UI styles was rebuilt.
+	void AvailableStylesChanged();
+
+	// Writes the growth hook cache statistics to the log file.
+	void WriteStyleSelectionStatistics();
+
+	// Writes any buffered style selection trace data to the trace file.
+	void FlushStyleSelectionTrace();
+
+	// Gets the call count and latency statistics of the growth hooks.
+	// The statistics are only collected when the HookStatistics option is enabled.
+	std::span<const HookStatistics* const> GetHookStatistics();
+
+	// Writes the growth hook call count and latency statistics to the log file.
+	void WriteHookStatistics();
+
+	// Writes the rebuild progress of the building compatibility table to the log file.
+	void WriteBuildingCompatibilityTableStatus();
+
 	void Install(const Preferences& preferences);
+
+	// Stops the background worker threads, this must be called before the DLL is unloaded.
+	void Shutdown();
 }
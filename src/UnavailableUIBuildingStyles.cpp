@@ -21,6 +21,7 @@
 
 #include "UnavailableUIBuildingStyles.h"
 #include "BuildingStyleUtil.h"
+#include "BuildingUtil.h"
 #include "cGZPersistResourceKey.h"
 #include "cIGZPersistDBSegment.h"
 #include "cIGZPersistDBSegmentMultiPackedFiles.h"
@@ -33,8 +34,10 @@
 #include "cRZAutoRefCount.h"
 #include "GZServPtrs.h"
 #include "Logger.h"
+#include "LotConfigurationManagerHooks.h"
 #include "PropertyData.h"
 #include "PropertyIDs.h"
+#include "StyleListSearch.h"
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -42,25 +45,6 @@
 
 namespace
 {
-	std::vector<uint32_t> GetAllBuildingTypes(cISC4BuildingDevelopmentSimulator& buildingDevelopmentSim)
-	{
-		uint32_t dummy = 0;
-
-		// GetAllBuildingTypes doesn't follow the pattern in many other SC4 APIs of
-		// returning the size in the count field when the data pointer is NULL, instead
-		// it only uses the return value.
-
-		const uint32_t count = buildingDevelopmentSim.GetAllBuildingTypes(nullptr, dummy);
-
-		std::vector<uint32_t> buildingTypes(count);
-
-		uint32_t vectorSize = count;
-
-		buildingDevelopmentSim.GetAllBuildingTypes(buildingTypes.data(), vectorSize);
-
-		return buildingTypes;
-	}
-
 	std::vector<uint32_t> GetAvailableStylesAsSortedVector(const BuildingStyleCollection& availableUIStyles)
 	{
 		std::vector<uint32_t> styles;
@@ -129,7 +113,8 @@ namespace
 	std::vector<UnavailableBuildingStyleInfo> GetUnavailableBuildingStyles(
 		cISC4City& city,
 		cIGZPersistResourceManager& resMan,
-		const std::vector<uint32_t>& sortedUIStyles)
+		const std::vector<uint32_t>& sortedUIStyles,
+		BuildingStylePostingLists& postingLists)
 	{
 		std::vector<UnavailableBuildingStyleInfo> styles;
 
@@ -137,10 +122,11 @@ namespace
 
 		if (pBuildingDevelopmentSim)
 		{
-			const std::vector<uint32_t> allBuildingTypes = GetAllBuildingTypes(*pBuildingDevelopmentSim);
+			const std::vector<uint32_t> allBuildingTypes = BuildingUtil::GetAllBuildingTypes(*pBuildingDevelopmentSim);
 
 			std::vector<uint32_t> buildingStyles;
 			std::vector<uint32_t> unavailableStyles;
+			std::vector<uint32_t> maxisStyles;
 
 			for (const uint32_t& buildingType : allBuildingTypes)
 			{
@@ -152,9 +138,10 @@ namespace
 
 					if (resMan.GetResource(key, GZIID_cISCResExemplar, exemplar.AsPPVoid(), 0, nullptr))
 					{
-						if (TryReadBuildingStylesPropertyAsSortedVector(
-							exemplar->AsISCPropertyHolder(),
-							buildingStyles))
+						cISCPropertyHolder* pPropertyHolder = exemplar->AsISCPropertyHolder();
+						const PropertyData<uint32_t> occupantGroups(pPropertyHolder, kOccupantGroupsProperty);
+
+						if (TryReadBuildingStylesPropertyAsSortedVector(pPropertyHolder, buildingStyles))
 						{
 							// std::set_difference extracts any styles that are not present in the UI into
 							// the unavailable styles vector.
@@ -179,6 +166,19 @@ namespace
 								// None of the building's styles are supported in the UI.
 								styles.emplace_back(key, unavailableStyles);
 							}
+
+							postingLists.AddBuilding(buildingType, buildingStyles, occupantGroups);
+						}
+						else
+						{
+							maxisStyles.clear();
+							std::copy_if(
+								occupantGroups.begin(),
+								occupantGroups.end(),
+								std::back_inserter(maxisStyles),
+								BuildingStyleUtil::IsMaxisStyleID);
+
+							postingLists.AddBuilding(buildingType, maxisStyles, occupantGroups);
 						}
 					}
 				}
@@ -326,7 +326,8 @@ UnavailableUIBuildingStyles::UnavailableUIBuildingStyles()
 
 void UnavailableUIBuildingStyles::Initialize(
 	cISC4City& city,
-	const BuildingStyleCollection& availableUIStyles)
+	const BuildingStyleCollection& availableUIStyles,
+	BuildingStylePostingLists& postingLists)
 {
 	if (!initialized)
 	{
@@ -337,7 +338,11 @@ void UnavailableUIBuildingStyles::Initialize(
 		if (resMan)
 		{
 			const std::vector<uint32_t> sortedUIStyles = GetAvailableStylesAsSortedVector(availableUIStyles);
-			const auto unavailableStyles = GetUnavailableBuildingStyles(city, *resMan, sortedUIStyles);
+			const auto unavailableStyles = GetUnavailableBuildingStyles(city, *resMan, sortedUIStyles, postingLists);
+
+			// The lot configurations were added to the style index when the
+			// lot configuration manager was initialized for the city.
+			postingLists.Finalize(LotConfigurationManagerHooks::GetLotConfigurationStyleIndex());
 
 			if (!unavailableStyles.empty())
 			{
@@ -358,6 +363,7 @@ void UnavailableUIBuildingStyles::Initialize(
 				logger.Write(LogLevel::Error, "\n");
 				logger.Flush();
 
+				// The std::set is ordered, so the list is sorted for the binary search in Contains.
 				unavailableBuildingStyleIDs.reserve(unavailableStylesSet.size());
 				unavailableBuildingStyleIDs.assign(unavailableStylesSet.begin(), unavailableStylesSet.end());
 			}
@@ -367,8 +373,7 @@ void UnavailableUIBuildingStyles::Initialize(
 
 bool UnavailableUIBuildingStyles::Contains(uint32_t styleID) const
 {
-	return std::find(
-		unavailableBuildingStyleIDs.begin(),
-		unavailableBuildingStyleIDs.end(),
-		styleID) != unavailableBuildingStyleIDs.end();
+	// This is called for every style of the buildings the game tests during growth,
+	// the list is usually empty or only has a few items.
+	return StyleListSearch::ContainsSorted(unavailableBuildingStyleIDs, styleID);
 }
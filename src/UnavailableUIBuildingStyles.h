@@ -22,6 +22,7 @@
 #pragma once
 #include "IUnavailableUIBuildingStyles.h"
 #include "BuildingStyleCollection.h"
+#include "BuildingStylePostingLists.h"
 #include <vector>
 
 class cISC4City;
@@ -31,11 +32,17 @@ class UnavailableUIBuildingStyles : public IUnavailableUIBuildingStyles
 public:
 	UnavailableUIBuildingStyles();
 
-	void Initialize(cISC4City& city, const BuildingStyleCollection& availableUIStyles);
+	// Checks for buildings that only have styles which are not present in the UI,
+	// the style posting lists are built from the same building exemplar scan.
+	void Initialize(
+		cISC4City& city,
+		const BuildingStyleCollection& availableUIStyles,
+		BuildingStylePostingLists& postingLists);
 
 	bool Contains(uint32_t styleID) const override;
 
 private:
+	// The style ids are sorted in ascending order.
 	std::vector<uint32_t> unavailableBuildingStyleIDs;
 	bool initialized;
 };
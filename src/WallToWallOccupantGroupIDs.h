@@ -0,0 +1,45 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+// The Wall-to-Wall occupant group ids.
+// This header only uses the C++ standard library, the group names are in
+// WallToWallOccupantGroups.h.
+
+static constexpr uint32_t IndustrialWallToWallOccupantGroup = 0xD02C802E;
+static constexpr uint32_t CommercialWallToWallOccupantGroup = 0xB5C00A05;
+static constexpr uint32_t ResidentialWallToWallOccupantGroup = 0xB5C00B05;
+static constexpr uint32_t GeneralWallToWallOccupantGroup = 0xB5C00DDE;
+static constexpr uint32_t HamburgWallToWallOccupantGroup = 0xB5C00F0A;
+static constexpr uint32_t ParisWallToWallOccupantGroup = 0xB5C00F0B;
+
+static constexpr std::array<uint32_t, 6> WallToWallOccupantGroupIDs =
+{
+	IndustrialWallToWallOccupantGroup,
+	CommercialWallToWallOccupantGroup,
+	ResidentialWallToWallOccupantGroup,
+	GeneralWallToWallOccupantGroup,
+	HamburgWallToWallOccupantGroup,
+	ParisWallToWallOccupantGroup
+};
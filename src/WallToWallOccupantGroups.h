@@ -21,15 +21,16 @@
 
 #pragma once
 #include "frozen/unordered_map.h"
+#include "WallToWallOccupantGroupIDs.h"
 #include <cstdint>
 #include <string_view>
 
 static constexpr frozen::unordered_map<uint32_t, const std::string_view, 6> WallToWallOccupantGroups =
 {
-	{ 0xD02C802E, "BTE: Ind. W2W" },
-	{ 0xB5C00A05, "BTE: Comm. W2W" },
-	{ 0xB5C00B05, "BTE: Res. W2W" },
-	{ 0xB5C00DDE, "BTE: W2W General" },
-	{ 0xB5C00F0A, "SFBT: Hamburg W2W" },
-	{ 0xB5C00F0B, "SFBT: Paris W2W" }
+	{ IndustrialWallToWallOccupantGroup, "BTE: Ind. W2W" },
+	{ CommercialWallToWallOccupantGroup, "BTE: Comm. W2W" },
+	{ ResidentialWallToWallOccupantGroup, "BTE: Res. W2W" },
+	{ GeneralWallToWallOccupantGroup, "BTE: W2W General" },
+	{ HamburgWallToWallOccupantGroup, "SFBT: Hamburg W2W" },
+	{ ParisWallToWallOccupantGroup, "SFBT: Paris W2W" }
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "SC4String.h"
+#include "SC4Vector.h"
+#include <cstddef>
+#include <cstdint>
+
+// The game's lot configuration class, only the fields that the DLL uses are named.
+struct cSC4LotConfiguration
+{
+	void* vtable;
+	uint32_t refCount;
+	uint32_t id;
+	SC4String name;
+	uint8_t unknown1[0x60];
+	SC4Vector<uint32_t> buildingOccupantGroups;
+};
+
+static_assert(offsetof(cSC4LotConfiguration, buildingOccupantGroups) == 0x80);
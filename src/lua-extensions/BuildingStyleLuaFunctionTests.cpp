@@ -31,6 +31,8 @@
 #include "Logger.h"
 #include "SC4Vector.h"
 #include "SCLuaUtil.h"
+#include "TractDeveloperHooks.h"
+#include <algorithm>
 #include <array>
 #include <string>
 #include <utility>
@@ -105,7 +107,8 @@ namespace
 
 	void RunLuaScriptTests(cISC4AdvisorSystem* pAdvisorSystem, cIGZLua5Thread* pIGZLua5Thread)
 	{
-		constexpr std::array<const char*, 13> BuildingStyleLuaTestFunctions =
+		// The array size is deduced from the initializers.
+		constexpr auto BuildingStyleLuaTestFunctions = std::to_array<const char*>(
 		{
 			"null45_building_style_test_is_build_all_styles_at_once",
 			"null45_building_style_test_get_years_between_style_changes",
@@ -120,7 +123,16 @@ namespace
 			"null45_building_style_test_get_style_name",
 			"null45_building_style_test_get_wall_to_wall_mode",
 			"null45_building_style_test_is_ui_button_checked",
-		};
+			"null45_building_style_test_get_hook_statistics",
+			"null45_building_style_test_get_buildings_with_style",
+			"null45_building_style_test_get_style_index",
+		});
+		static_assert(
+			std::none_of(
+				BuildingStyleLuaTestFunctions.begin(),
+				BuildingStyleLuaTestFunctions.end(),
+				[](const char* name) { return name == nullptr; }),
+			"BuildingStyleLuaTestFunctions has an entry without a name.");
 
 		for (const auto& item : BuildingStyleLuaTestFunctions)
 		{
@@ -151,5 +163,6 @@ void BuildingStyleLuaFunctionTests::Run()
 		RunLuaScriptTests(pAdvisorSystem, pIGZLua5Thread);
 
 		pTractDeveloper->SetActiveStyles(cityStyles);
+		TractDeveloperHooks::ActiveStylesChanged();
 	}
 }
@@ -21,12 +21,18 @@
 
 #include "BuildingStyleLuaFunctions.h"
 #include "BuildingStyleButtons.h"
+#include "BuildingStyleIndex.h"
 #include "cRZBaseString.h"
 #include "GlobalPointers.h"
+#include "HookStatistics.h"
 #include "SC4Vector.h"
 #include "SCLuaUtil.h"
+#include "TractDeveloperHooks.h"
 #include "SafeInt.hpp"
 #include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
 
 namespace
 {
@@ -75,6 +81,29 @@ namespace
 		return results;
 	}
 
+	void SetTableNumberField(cISCLua* pLua, const std::string_view& name, double value)
+	{
+		pLua->PushLString(name.data(), name.size());
+		pLua->PushNumber(value);
+		pLua->SetTable(-3);
+	}
+
+	void SetTableArrayField(cISCLua* pLua, const std::string_view& name, std::span<const uint32_t> values)
+	{
+		pLua->PushLString(name.data(), name.size());
+		pLua->NewTable();
+
+		int32_t luaTableIndex = 1; // Lua table indexing start at 1.
+
+		for (const uint32_t value : values)
+		{
+			pLua->PushNumber(value);
+			pLua->RawSetI(-2, luaTableIndex++);
+		}
+
+		pLua->SetTable(-3);
+	}
+
 	enum UIButton : uint32_t
 	{
 		UIButtonNoKickOut = 0,
@@ -270,6 +299,7 @@ int32_t BuildingStyleLuaFunctions::set_active_style_ids(lua_State* pState)
 			sc4Vector.push_back(vector.data(), vector.size());
 
 			spBuildingSelectWinManager->GetTractDeveloper()->SetActiveStyles(sc4Vector);
+			TractDeveloperHooks::ActiveStylesChanged();
 			result = true;
 		}
 	}
@@ -355,3 +385,102 @@ int32_t BuildingStyleLuaFunctions::is_ui_button_checked(lua_State* pState)
 	lua->PushBoolean(result);
 	return 1;
 }
+
+int32_t BuildingStyleLuaFunctions::get_hook_statistics(lua_State* pState)
+{
+	cRZAutoRefCount<cISCLua> lua = SCLuaUtil::GetISCLuaFromFunctionState(pState);
+
+	// Push a new table onto the stack.
+	lua->NewTable();
+
+	for (const HookStatistics* pStatistics : TractDeveloperHooks::GetHookStatistics())
+	{
+		const char* const name = pStatistics->GetName();
+		lua->PushLString(name, std::strlen(name));
+
+		// Push the hook's statistics table onto the stack.
+		lua->NewTable();
+
+		SetTableNumberField(lua, "call_count", static_cast<double>(pStatistics->GetCallCount()));
+		SetTableNumberField(lua, "total_ticks", static_cast<double>(pStatistics->GetTotalTicks()));
+		SetTableNumberField(lua, "max_ticks", static_cast<double>(pStatistics->GetMaxTicks()));
+
+		lua->PushLString("histogram", 9);
+		lua->NewTable();
+
+		int32_t luaTableIndex = 1; // Lua table indexing start at 1.
+
+		for (const uint64_t count : pStatistics->GetBuckets())
+		{
+			lua->PushNumber(static_cast<double>(count));
+			lua->RawSetI(-2, luaTableIndex++);
+		}
+
+		lua->SetTable(-3); // histogram
+		lua->SetTable(-3); // hook statistics
+	}
+
+	return 1;
+}
+
+int32_t BuildingStyleLuaFunctions::get_buildings_with_style(lua_State* pState)
+{
+	cRZAutoRefCount<cISCLua> lua = SCLuaUtil::GetISCLuaFromFunctionState(pState);
+
+	const int32_t parameterCount = lua->GetTop();
+
+	if (parameterCount == 1)
+	{
+		uint32_t value = 0;
+
+		if (TryGetLuaValueAsUint32(lua, -1, value))
+		{
+			const BuildingStylePostingLists& postingLists = spBuildingSelectWinManager->GetBuildingStylePostingLists();
+
+			// Push a new table onto the stack.
+			lua->NewTable();
+
+			SetTableArrayField(lua, "building_types", postingLists.GetBuildingTypes(value));
+			SetTableArrayField(lua, "lot_configuration_ids", postingLists.GetLotConfigurationIDs(value));
+
+			return 1;
+		}
+	}
+
+	lua->PushNil();
+	return 1;
+}
+
+int32_t BuildingStyleLuaFunctions::get_style_index(lua_State* pState)
+{
+	cRZAutoRefCount<cISCLua> lua = SCLuaUtil::GetISCLuaFromFunctionState(pState);
+
+	const int32_t parameterCount = lua->GetTop();
+
+	if (parameterCount == 1)
+	{
+		uint32_t styleId = 0;
+
+		if (TryGetLuaValueAsUint32(lua, -1, styleId))
+		{
+			const std::optional<uint32_t> index = spBuildingSelectWinManager->GetBuildingStyleIndex().GetStyleIndex(styleId);
+
+			if (index.has_value())
+			{
+				lua->PushNumber(index.value());
+				return 1;
+			}
+		}
+	}
+
+	lua->PushNil();
+	return 1;
+}
+
+int32_t BuildingStyleLuaFunctions::get_style_index_count(lua_State* pState)
+{
+	cRZAutoRefCount<cISCLua> lua = SCLuaUtil::GetISCLuaFromFunctionState(pState);
+
+	lua->PushNumber(static_cast<double>(spBuildingSelectWinManager->GetBuildingStyleIndex().GetStyleIndexCount()));
+	return 1;
+}
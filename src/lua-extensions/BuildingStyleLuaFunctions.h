@@ -65,4 +65,19 @@ namespace BuildingStyleLuaFunctions
 	// Gets a value indicating if the specified option is active in
 	// the building style UI.
 	int32_t is_ui_button_checked(lua_State* pState);
+
+	// Gets a table containing the call count and latency statistics of
+	// the growth hooks, the table is keyed by the hook name.
+	int32_t get_hook_statistics(lua_State* pState);
+
+	// Gets a table containing sorted lists of the building types and lot configuration ids
+	// that have the specified style id or wall to wall occupant group.
+	int32_t get_buildings_with_style(lua_State* pState);
+
+	// Gets the style index that was assigned to the specified style id, the indexes
+	// are in the range [0, get_style_index_count()).
+	int32_t get_style_index(lua_State* pState);
+
+	// Gets the number of style indexes.
+	int32_t get_style_index_count(lua_State* pState);
 }
\ No newline at end of file
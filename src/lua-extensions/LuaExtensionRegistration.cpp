@@ -26,6 +26,7 @@
 #include "DebugUtil.h"
 #include "Logger.h"
 #include "SCLuaUtil.h"
+#include <algorithm>
 #include <array>
 #include <string>
 #include <utility>
@@ -129,20 +130,31 @@ namespace
 
 	void RegisterBuildingStyleLuaFunctions(cISC4AdvisorSystem* pAdvisorSystem)
 	{
-		constexpr std::array<std::pair<std::string_view, lua_CFunction>, 11> BuildingStyleLuaRegistrationArray =
+		// The array size is deduced from the initializers.
+		constexpr auto BuildingStyleLuaRegistrationArray = std::to_array<std::pair<std::string_view, lua_CFunction>>(
 		{
-			std::pair("is_build_all_styles_at_once", BuildingStyleLuaFunctions::is_build_all_styles_at_once),
-			std::pair("get_years_between_style_changes", BuildingStyleLuaFunctions::get_years_between_style_changes),
-			std::pair("get_available_style_ids", BuildingStyleLuaFunctions::get_available_style_ids),
-			std::pair("get_available_style_name_id_pairs", BuildingStyleLuaFunctions::get_available_style_name_id_pairs),
-			std::pair("is_style_available", BuildingStyleLuaFunctions::is_style_available),
-			std::pair("get_active_style_ids", BuildingStyleLuaFunctions::get_active_style_ids),
-			std::pair("get_active_style_name_id_pairs", BuildingStyleLuaFunctions::get_active_style_name_id_pairs),
-			std::pair("set_active_style_ids", BuildingStyleLuaFunctions::set_active_style_ids),
-			std::pair("get_style_name", BuildingStyleLuaFunctions::get_style_name),
-			std::pair("get_wall_to_wall_mode", BuildingStyleLuaFunctions::get_wall_to_wall_mode),
-			std::pair("is_ui_button_checked", BuildingStyleLuaFunctions::is_ui_button_checked)
-		};
+			{ "is_build_all_styles_at_once", BuildingStyleLuaFunctions::is_build_all_styles_at_once },
+			{ "get_years_between_style_changes", BuildingStyleLuaFunctions::get_years_between_style_changes },
+			{ "get_available_style_ids", BuildingStyleLuaFunctions::get_available_style_ids },
+			{ "get_available_style_name_id_pairs", BuildingStyleLuaFunctions::get_available_style_name_id_pairs },
+			{ "is_style_available", BuildingStyleLuaFunctions::is_style_available },
+			{ "get_active_style_ids", BuildingStyleLuaFunctions::get_active_style_ids },
+			{ "get_active_style_name_id_pairs", BuildingStyleLuaFunctions::get_active_style_name_id_pairs },
+			{ "set_active_style_ids", BuildingStyleLuaFunctions::set_active_style_ids },
+			{ "get_style_name", BuildingStyleLuaFunctions::get_style_name },
+			{ "get_wall_to_wall_mode", BuildingStyleLuaFunctions::get_wall_to_wall_mode },
+			{ "is_ui_button_checked", BuildingStyleLuaFunctions::is_ui_button_checked },
+			{ "get_hook_statistics", BuildingStyleLuaFunctions::get_hook_statistics },
+			{ "get_buildings_with_style", BuildingStyleLuaFunctions::get_buildings_with_style },
+			{ "get_style_index", BuildingStyleLuaFunctions::get_style_index },
+			{ "get_style_index_count", BuildingStyleLuaFunctions::get_style_index_count }
+		});
+		static_assert(
+			std::none_of(
+				BuildingStyleLuaRegistrationArray.begin(),
+				BuildingStyleLuaRegistrationArray.end(),
+				[](const auto& item) { return item.first.empty() || item.second == nullptr; }),
+			"BuildingStyleLuaRegistrationArray has an entry without a name or function.");
 
 		for (const auto& item : BuildingStyleLuaRegistrationArray)
 		{
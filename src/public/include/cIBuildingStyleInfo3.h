@@ -0,0 +1,95 @@
+/*
+* The public interface header for the BuildingStyleInfo3 GZCOM class.
+*
+* This header uses the MIT license (https://opensource.org/license/mit).
+*
+* Copyright (c) 2024, 2025, 2026 Nicholas Hayes
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the Software),
+* to deal in the Software without restriction, including without limitation the
+* rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+* sell copies of the Software,* and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#pragma once
+#include "cIBuildingStyleInfo2.h"
+
+static const uint32_t GZIID_cIBuildingStyleInfo3 = 0x1F7A3C65;
+
+class cIBuildingStyleInfo3 : public cIBuildingStyleInfo2
+{
+public:
+	/**
+	 * @brief Gets the building types that have the specified style or wall to wall occupant group.
+	 * @param value The style id or wall to wall occupant group.
+	 * @param pBuildingTypes A pointer to the destination array.
+	 * @param size The size of the destination array.
+	 * @return The number of items copied to the destination array.
+	 * When pBuildingTypes is NULL and size is 0, the total number of items will be returned.
+	 * The building types are sorted in ascending order.
+	 */
+	virtual uint32_t GetBuildingTypesWithStyle(uint32_t value, uint32_t* pBuildingTypes, uint32_t size) const = 0;
+
+	/**
+	 * @brief Gets the lot configuration ids that have the specified style or wall to wall occupant group.
+	 * @param value The style id or wall to wall occupant group.
+	 * @param pLotConfigurationIds A pointer to the destination array.
+	 * @param size The size of the destination array.
+	 * @return The number of items copied to the destination array.
+	 * When pLotConfigurationIds is NULL and size is 0, the total number of items will be returned.
+	 * The lot configuration ids are sorted in ascending order.
+	 * Lots with buildings that use the Building Styles property are listed under the
+	 * BTE: W2W General occupant group (0xB5C00DDE) when they are wall to wall.
+	 */
+	virtual uint32_t GetLotConfigurationIdsWithStyle(
+		uint32_t value,
+		uint32_t* pLotConfigurationIds,
+		uint32_t size) const = 0;
+
+	/**
+	 * @brief Gets the style index of the specified style.
+	 * @param style The style id.
+	 * @param index Receives the style index, in the range [0, GetStyleIndexCount()).
+	 * @return True if the style has a style index; otherwise, false.
+	 * The style indexes are assigned to the available styles when the first city is loaded,
+	 * they do not change for the rest of the game session.
+	 */
+	virtual bool GetStyleIndex(uint32_t style, uint32_t& index) const = 0;
+
+	/**
+	 * @brief Gets the number of style indexes.
+	 * @return The number of style indexes, or 0 if a city has not been loaded.
+	 */
+	virtual uint32_t GetStyleIndexCount() const = 0;
+
+	/**
+	 * @brief Gets a style mask with a bit set for the style index of each style in the list.
+	 * @param pStyles A pointer to the list of style ids.
+	 * @param styleCount The number of items in the style list.
+	 * @param pMaskWords A pointer to the destination array.
+	 * @param size The size of the destination array.
+	 * @return The number of words copied to the destination array.
+	 * When pMaskWords is NULL and size is 0, the total number of words will be returned.
+	 * The style index N is stored in bit (N % 32) of word (N / 32), styles that do not
+	 * have a style index are ignored.
+	 * Two style masks have a style in common if the bitwise AND of any word pair is non-zero.
+	 */
+	virtual uint32_t GetStyleMask(
+		const uint32_t* pStyles,
+		uint32_t styleCount,
+		uint32_t* pMaskWords,
+		uint32_t size) const = 0;
+};
\ No newline at end of file
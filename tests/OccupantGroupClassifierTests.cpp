@@ -0,0 +1,75 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestHarness.h"
+#include "BuildingStyleButtons.h"
+#include "MaxisBuildingStyleUIControlIDs.h"
+#include "OccupantGroupClassifier.h"
+#include "ReservedStyleIDs.h"
+#include "WallToWallOccupantGroupIDs.h"
+#include <array>
+
+using namespace OccupantGroupClassifier;
+
+TEST_CASE(Classify_WallToWallOccupantGroups)
+{
+	for (const uint32_t group : WallToWallOccupantGroupIDs)
+	{
+		CHECK(Classify(group) == WallToWall);
+	}
+}
+
+TEST_CASE(Classify_ReservedStyleIDs)
+{
+	for (const uint32_t id : MaxisUIControlIDs)
+	{
+		CHECK((Classify(id) & MaxisUIControl) != 0);
+	}
+
+	for (const uint32_t id : OptionalButtonIDs)
+	{
+		CHECK((Classify(id) & OptionalButton) != 0);
+	}
+
+	CHECK(Classify(PIMXPlaceholderStyleID) == PIMXPlaceholder);
+	CHECK(Classify(0) == ReservedButtonRange);
+	CHECK(Classify(StyleControlReservedButtonRangeEnd) == ReservedButtonRange);
+	CHECK(Classify(StyleControlReservedButtonRangeEnd + 1) == None);
+}
+
+TEST_CASE(Classify_ValueRanges)
+{
+	CHECK(Classify(0x1FFF) == None);
+	CHECK(Classify(0x2000) == MaxisStyle);
+	CHECK(Classify(0x2003) == MaxisStyle);
+	CHECK(Classify(0x2004) == None);
+	CHECK(Classify(0x3000) == IndustryType);
+	CHECK(Classify(0x3002) == IndustryType);
+	CHECK(Classify(0x3003) == None);
+}
+
+TEST_CASE(ClassifyAll_CombinesFlags)
+{
+	const std::array<uint32_t, 3> values = { 0x2001, 0x3001, GeneralWallToWallOccupantGroup };
+
+	CHECK(ClassifyAll(values) == (MaxisStyle | IndustryType | WallToWall));
+	CHECK(ClassifyAll({}) == None);
+}
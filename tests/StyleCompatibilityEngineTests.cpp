@@ -0,0 +1,219 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestHarness.h"
+#include "PropertyIDs.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleListSearch.h"
+#include "WallToWallOccupantGroupIDs.h"
+#include <array>
+#include <vector>
+
+using WallToWallOption = IBuildingSelectWinContext::WallToWallOption;
+
+namespace
+{
+	constexpr uint32_t Chicago1890 = 0x2000;
+	constexpr uint32_t NewYork1940 = 0x2001;
+	constexpr uint32_t Houston1990 = 0x2002;
+	constexpr uint32_t Euro = 0x2003;
+	constexpr uint32_t CustomStyle = 0x1234;
+
+	constexpr uint32_t IndustryAnchor = 0x3000;
+	constexpr uint32_t IndustryOut = 0x3002;
+
+	bool IsAnyStyleAvailable(uint32_t)
+	{
+		return true;
+	}
+}
+
+TEST_CASE(CheckWallToWallOption_Mixed_AllowsEverything)
+{
+	CHECK(StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Mixed, true));
+	CHECK(StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Mixed, false));
+}
+
+TEST_CASE(CheckWallToWallOption_Only_RequiresWallToWall)
+{
+	CHECK(StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Only, true));
+	CHECK(!StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Only, false));
+}
+
+TEST_CASE(CheckWallToWallOption_Block_RejectsWallToWall)
+{
+	CHECK(!StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Block, true));
+	CHECK(StyleCompatibilityEngine::CheckWallToWallOption(WallToWallOption::Block, false));
+}
+
+TEST_CASE(HasWallToWallOccupantGroup_FindsEveryGroup)
+{
+	for (const uint32_t group : WallToWallOccupantGroupIDs)
+	{
+		const std::array<uint32_t, 3> occupantGroups = { 0x1000, group, Chicago1890 };
+
+		CHECK(StyleCompatibilityEngine::HasWallToWallOccupantGroup(occupantGroups));
+	}
+
+	const std::array<uint32_t, 3> occupantGroups = { 0x1000, Chicago1890, IndustryAnchor };
+
+	CHECK(!StyleCompatibilityEngine::HasWallToWallOccupantGroup(occupantGroups));
+	CHECK(!StyleCompatibilityEngine::HasWallToWallOccupantGroup({}));
+}
+
+TEST_CASE(GetIndustryTypeOccupantGroup_ReturnsFirstIndustryType)
+{
+	const std::array<uint32_t, 3> industrial = { 0x1000, IndustryOut, IndustryAnchor };
+	const std::array<uint32_t, 3> outOfRange = { 0x2FFF, 0x3003, Chicago1890 };
+
+	CHECK(StyleCompatibilityEngine::GetIndustryTypeOccupantGroup(industrial) == IndustryOut);
+	CHECK(StyleCompatibilityEngine::GetIndustryTypeOccupantGroup(outOfRange) == 0);
+	CHECK(StyleCompatibilityEngine::GetIndustryTypeOccupantGroup({}) == 0);
+}
+
+TEST_CASE(IsCompatibleWithAllStyles_OnlyIndustrialWithoutBuildingStyles)
+{
+	// Industrial buildings without the Building Styles property grow under every style.
+	CHECK(StyleCompatibilityEngine::IsCompatibleWithAllStyles(false, true));
+	CHECK(!StyleCompatibilityEngine::IsCompatibleWithAllStyles(true, true));
+	CHECK(!StyleCompatibilityEngine::IsCompatibleWithAllStyles(false, false));
+	CHECK(!StyleCompatibilityEngine::IsCompatibleWithAllStyles(true, false));
+}
+
+TEST_CASE(ContainsStyle_MatchesListValues)
+{
+	const std::array<uint32_t, 3> styles = { Chicago1890, CustomStyle, Euro };
+
+	CHECK(StyleCompatibilityEngine::ContainsStyle(styles, CustomStyle));
+	CHECK(StyleCompatibilityEngine::ContainsStyle(styles, Euro));
+	CHECK(!StyleCompatibilityEngine::ContainsStyle(styles, NewYork1940));
+	CHECK(!StyleCompatibilityEngine::ContainsStyle({}, Chicago1890));
+}
+
+TEST_CASE(GetLotConfigurationStyleValues_AppendsMarkers)
+{
+	const std::array<uint32_t, 2> buildingStyles = { CustomStyle, Euro };
+	const std::array<uint32_t, 3> occupantGroups = { 0x1000, IndustryAnchor, CommercialWallToWallOccupantGroup };
+
+	const std::vector<uint32_t> values = StyleCompatibilityEngine::GetLotConfigurationStyleValues(
+		buildingStyles,
+		true,
+		occupantGroups);
+
+	// The styles are followed by the Building Styles property id, the generic
+	// W2W marker and the industry type occupant group.
+	const std::vector<uint32_t> expected =
+	{
+		CustomStyle,
+		Euro,
+		kBuildingStylesProperty,
+		GeneralWallToWallOccupantGroup,
+		IndustryAnchor
+	};
+
+	CHECK(values == expected);
+}
+
+TEST_CASE(GetLotConfigurationStyleValues_OmitsAbsentMarkers)
+{
+	const std::array<uint32_t, 1> buildingStyles = { CustomStyle };
+	const std::array<uint32_t, 2> occupantGroups = { 0x1000, ResidentialWallToWallOccupantGroup };
+
+	const std::vector<uint32_t> values = StyleCompatibilityEngine::GetLotConfigurationStyleValues(
+		buildingStyles,
+		false,
+		occupantGroups);
+
+	const std::vector<uint32_t> expected = { CustomStyle, kBuildingStylesProperty };
+
+	CHECK(values == expected);
+}
+
+TEST_CASE(GetLotConfigurationStyleValues_EmptyWithoutStyles)
+{
+	const std::array<uint32_t, 1> occupantGroups = { IndustryAnchor };
+
+	CHECK(StyleCompatibilityEngine::GetLotConfigurationStyleValues({}, true, occupantGroups).empty());
+}
+
+TEST_CASE(StylesMatch_SharedStyle)
+{
+	const std::array<uint32_t, 2> newBuildingStyles = { NewYork1940, CustomStyle };
+	const std::array<uint32_t, 2> oldBuildingStyles = { Chicago1890, CustomStyle };
+
+	const std::optional<bool> result = StyleCompatibilityEngine::StylesMatch(
+		newBuildingStyles,
+		oldBuildingStyles,
+		IsAnyStyleAvailable);
+
+	CHECK(result.has_value() && result.value());
+}
+
+TEST_CASE(StylesMatch_NoSharedStyle)
+{
+	const std::array<uint32_t, 2> newBuildingStyles = { NewYork1940, Houston1990 };
+	const std::array<uint32_t, 2> oldBuildingStyles = { Chicago1890, Euro };
+
+	const std::optional<bool> result = StyleCompatibilityEngine::StylesMatch(
+		newBuildingStyles,
+		oldBuildingStyles,
+		IsAnyStyleAvailable);
+
+	CHECK(result.has_value() && !result.value());
+}
+
+TEST_CASE(StylesMatch_IgnoresUnavailableStyles)
+{
+	const std::array<uint32_t, 2> newBuildingStyles = { CustomStyle, Chicago1890 };
+	const std::array<uint32_t, 1> oldBuildingStyles = { CustomStyle };
+
+	// The shared style is not in the UI, so only Chicago 1890 is compared.
+	const std::optional<bool> result = StyleCompatibilityEngine::StylesMatch(
+		newBuildingStyles,
+		oldBuildingStyles,
+		[](uint32_t style) { return style != CustomStyle; });
+
+	CHECK(result.has_value() && !result.value());
+}
+
+TEST_CASE(StylesMatch_NoValueWhenNothingIsAvailable)
+{
+	const std::array<uint32_t, 2> newBuildingStyles = { CustomStyle, Chicago1890 };
+	const std::array<uint32_t, 2> oldBuildingStyles = { CustomStyle, Chicago1890 };
+
+	const std::optional<bool> result = StyleCompatibilityEngine::StylesMatch(
+		newBuildingStyles,
+		oldBuildingStyles,
+		[](uint32_t) { return false; });
+
+	CHECK(!result.has_value());
+}
+
+TEST_CASE(FindFirstCommonValue_ReturnsFirstCandidate)
+{
+	const std::array<uint32_t, 3> candidates = { Euro, CustomStyle, Chicago1890 };
+	const std::array<uint32_t, 3> values = { Chicago1890, 0x1000, CustomStyle };
+
+	const std::optional<uint32_t> result = StyleListSearch::FindFirstCommonValue(candidates, values);
+
+	CHECK(result.has_value() && result.value() == CustomStyle);
+	CHECK(!StyleListSearch::FindFirstCommonValue(candidates, {}).has_value());
+}
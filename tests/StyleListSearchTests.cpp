@@ -0,0 +1,122 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestHarness.h"
+#include "StyleListSearch.h"
+#include <array>
+#include <vector>
+
+TEST_CASE(ContainsSorted_EmptyList)
+{
+	CHECK(!StyleListSearch::ContainsSorted(std::span<const uint32_t>(), 0x2000));
+}
+
+TEST_CASE(ContainsSorted_SingleValue)
+{
+	const std::array<uint32_t, 1> values{ 0x2000 };
+
+	CHECK(StyleListSearch::ContainsSorted(values, 0x2000));
+	CHECK(!StyleListSearch::ContainsSorted(values, 0x1FFF));
+	CHECK(!StyleListSearch::ContainsSorted(values, 0x2001));
+}
+
+TEST_CASE(ContainsSorted_FindsEveryValue)
+{
+	std::vector<uint32_t> values;
+
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		values.push_back(0x10000 + (i * 3));
+	}
+
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		CHECK(StyleListSearch::ContainsSorted(values, 0x10000 + (i * 3)));
+		CHECK(!StyleListSearch::ContainsSorted(values, 0x10000 + (i * 3) + 1));
+	}
+
+	CHECK(!StyleListSearch::ContainsSorted(values, 0));
+	CHECK(!StyleListSearch::ContainsSorted(values, 0xFFFFFFFF));
+}
+
+namespace
+{
+	constexpr std::array<StyleListSearch::InstructionSet, 3> AllInstructionSets =
+	{
+		StyleListSearch::InstructionSet::Scalar,
+		StyleListSearch::InstructionSet::SSE2,
+		StyleListSearch::InstructionSet::AVX2,
+	};
+
+	bool ContainsScalar(std::span<const uint32_t> values, uint32_t value)
+	{
+		return StyleListSearch::Contains(StyleListSearch::InstructionSet::Scalar, values, value);
+	}
+}
+
+TEST_CASE(Contains_VectorKernelsMatchScalarOnTailLengths)
+{
+	constexpr uint32_t Needle = 0x2002;
+
+	// The lengths cover the SSE2 and AVX2 tails, with and without a full vector before them.
+	for (size_t count = 0; count <= 24; count++)
+	{
+		// The values after the end of the list are set to the needle, a kernel
+		// that reads past the end would report a match.
+		std::vector<uint32_t> buffer(count + 8, Needle);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			buffer[i] = 0x1000 + static_cast<uint32_t>(i);
+		}
+
+		const std::span<const uint32_t> values(buffer.data(), count);
+
+		for (const StyleListSearch::InstructionSet instructionSet : AllInstructionSets)
+		{
+			if (!StyleListSearch::IsInstructionSetSupported(instructionSet))
+			{
+				continue;
+			}
+
+			CHECK(StyleListSearch::Contains(instructionSet, values, Needle) == ContainsScalar(values, Needle));
+			CHECK(!StyleListSearch::Contains(instructionSet, values, Needle));
+
+			for (size_t position = 0; position < count; position++)
+			{
+				const uint32_t value = values[position];
+
+				CHECK(StyleListSearch::Contains(instructionSet, values, value) == ContainsScalar(values, value));
+				CHECK(StyleListSearch::Contains(instructionSet, values, value));
+			}
+		}
+	}
+}
+
+TEST_CASE(Contains_UsesTheSelectedInstructionSet)
+{
+	const std::array<uint32_t, 9> values{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	CHECK(StyleListSearch::IsInstructionSetSupported(StyleListSearch::InstructionSet::Scalar));
+	CHECK(StyleListSearch::Contains(values, 9));
+	CHECK(!StyleListSearch::Contains(values, 10));
+	CHECK(StyleListSearch::GetInstructionSetName() != nullptr);
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestHarness.h"
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	struct TestCase
+	{
+		std::string_view name;
+		TestHarness::TestFunction function;
+	};
+
+	std::vector<TestCase>& GetTestCases()
+	{
+		// A function local static avoids depending on the initialization order of
+		// the registrations in the other translation units.
+		static std::vector<TestCase> testCases;
+		return testCases;
+	}
+
+	int failureCount = 0;
+}
+
+TestHarness::Registration::Registration(std::string_view name, TestFunction function)
+{
+	GetTestCases().push_back(TestCase{ name, function });
+}
+
+void TestHarness::ReportFailure(const char* file, int line, const char* expression)
+{
+	std::printf("%s(%d): CHECK(%s) failed\n", file, line, expression);
+	failureCount++;
+}
+
+int main()
+{
+	int failedTestCount = 0;
+
+	for (const TestCase& testCase : GetTestCases())
+	{
+		const int previousFailureCount = failureCount;
+
+		testCase.function();
+
+		if (failureCount != previousFailureCount)
+		{
+			std::printf("FAILED: %.*s\n", static_cast<int>(testCase.name.size()), testCase.name.data());
+			failedTestCount++;
+		}
+	}
+
+	std::printf(
+		"%d of %d tests passed.\n",
+		static_cast<int>(GetTestCases().size()) - failedTestCount,
+		static_cast<int>(GetTestCases().size()));
+
+	return failedTestCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,283 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestHarness.h"
+#include "BuildingStyleCatalog.h"
+#include "IBuildingSelectWinContext.h"
+#include "PropertyIDs.h"
+#include "StyleSelectionTraceFormat.h"
+#include "TraceReader.h"
+#include "TraceReplayer.h"
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+using RecordType = StyleSelectionTraceFormat::RecordType;
+
+namespace
+{
+	constexpr uint32_t Chicago1890 = 0x2000;
+	constexpr uint32_t NewYork1940 = 0x2001;
+	constexpr uint32_t Houston1990 = 0x2002;
+
+	constexpr uint32_t PurposeResidence = 1;
+	constexpr uint32_t PurposeManufacturing = 7;
+
+	constexpr uint8_t DevelopmentTypeLotSameSize = 2;
+	constexpr uint8_t DevelopmentTypeLotAggregation = 3;
+
+	// Writes the trace records in the same layout as the plugin's StyleSelectionTrace class.
+	class TraceBuilder
+	{
+	public:
+		TraceBuilder()
+		{
+			Write(StyleSelectionTraceFormat::Signature);
+			Write(StyleSelectionTraceFormat::Version);
+		}
+
+		TraceBuilder& Context(
+			uint32_t epoch,
+			uint8_t wallToWallOption,
+			uint8_t lotZoningOptions,
+			bool preventCrossStyleRedevelopment,
+			std::initializer_list<uint32_t> activeStyles,
+			std::initializer_list<uint32_t> availableStyles)
+		{
+			Write(RecordType::Context);
+			Write(epoch);
+			Write(wallToWallOption);
+			Write(lotZoningOptions);
+			Write(static_cast<uint8_t>(preventCrossStyleRedevelopment));
+			Write(static_cast<uint8_t>(0));
+			Write(static_cast<uint32_t>(0));
+			Write(activeStyles);
+			Write(availableStyles);
+			return *this;
+		}
+
+		TraceBuilder& Building(uint32_t buildingType, uint8_t flags, std::initializer_list<uint32_t> styles)
+		{
+			Write(RecordType::BuildingProperties);
+			Write(buildingType);
+			Write(flags);
+			Write(styles);
+			return *this;
+		}
+
+		TraceBuilder& LotConfiguration(uint32_t lotConfigurationID, std::initializer_list<uint32_t> occupantGroups)
+		{
+			Write(RecordType::LotConfigurationProperties);
+			Write(lotConfigurationID);
+			Write(occupantGroups);
+			return *this;
+		}
+
+		TraceBuilder& LotCheck(uint32_t lotConfigurationID, uint32_t purpose, bool result)
+		{
+			Write(RecordType::LotCheck);
+			Write(lotConfigurationID);
+			Write(purpose);
+			Write(static_cast<uint8_t>(result));
+			return *this;
+		}
+
+		TraceBuilder& BuildingCheck(
+			uint32_t buildingType,
+			uint32_t purpose,
+			uint8_t developmentType,
+			uint32_t existingBuildingType,
+			std::initializer_list<uint32_t> existingBuildingStyles,
+			bool result)
+		{
+			Write(RecordType::BuildingCheck);
+			Write(buildingType);
+			Write(purpose);
+			Write(developmentType);
+			Write(static_cast<uint32_t>(0));
+			Write(static_cast<uint32_t>(0));
+			Write(static_cast<uint8_t>(1));
+			Write(static_cast<uint8_t>(1));
+			Write(static_cast<uint8_t>(0));
+			Write(existingBuildingType);
+			Write(existingBuildingStyles);
+			Write(static_cast<uint8_t>(result));
+			return *this;
+		}
+
+		std::string Bytes() const
+		{
+			return bytes;
+		}
+
+	private:
+		template<typename T> void Write(T value)
+		{
+			bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+
+		void Write(std::initializer_list<uint32_t> values)
+		{
+			Write(static_cast<uint32_t>(values.size()));
+
+			for (const uint32_t value : values)
+			{
+				Write(value);
+			}
+		}
+
+		std::string bytes;
+	};
+
+	bool ReadTrace(const std::string& bytes, Trace& trace, std::string& errorMessage)
+	{
+		std::istringstream stream(bytes);
+
+		return TraceReader::Read(stream, trace, errorMessage);
+	}
+
+	TraceReplayer::ReplayResult ReplayTrace(const TraceBuilder& builder)
+	{
+		Trace trace;
+		std::string errorMessage;
+
+		CHECK(ReadTrace(builder.Bytes(), trace, errorMessage));
+
+		return TraceReplayer::Replay(trace);
+	}
+}
+
+TEST_CASE(TraceReader_RejectsInvalidSignature)
+{
+	Trace trace;
+	std::string errorMessage;
+
+	CHECK(!ReadTrace(std::string("NOPE\x02\0\0\0", 8), trace, errorMessage));
+	CHECK(!errorMessage.empty());
+}
+
+TEST_CASE(TraceReader_RejectsTruncatedRecord)
+{
+	std::string bytes = TraceBuilder()
+		.Context(1, 0, 0, false, { Chicago1890 }, { Chicago1890 })
+		.Bytes();
+	bytes.pop_back();
+
+	Trace trace;
+	std::string errorMessage;
+
+	CHECK(!ReadTrace(bytes, trace, errorMessage));
+}
+
+TEST_CASE(TraceReader_ReadsRecords)
+{
+	const std::string bytes = TraceBuilder()
+		.Context(7, 0, 0, true, { Chicago1890, NewYork1940 }, { Chicago1890, NewYork1940, Houston1990 })
+		.LotConfiguration(0x100, { 0x1000, Chicago1890 })
+		.LotCheck(0x100, PurposeResidence, true)
+		.Building(0x200, BuildingStyleRecord::FlagHasBuildingStylesProperty, { NewYork1940 })
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotSameSize, 0x300, { Houston1990 }, false)
+		.Bytes();
+
+	Trace trace;
+	std::string errorMessage;
+
+	CHECK(ReadTrace(bytes, trace, errorMessage));
+	CHECK(trace.contexts.size() == 1);
+	CHECK(trace.contexts[0].epoch == 7);
+	CHECK(trace.contexts[0].preventCrossStyleRedevelopment);
+	CHECK(trace.contexts[0].availableStyles.size() == 3);
+	CHECK(trace.lotConfigurations.at(0x100).size() == 2);
+	CHECK(trace.lotChecks.size() == 1);
+	CHECK(trace.buildingChecks.size() == 1);
+	CHECK(trace.buildingChecks[0].existingBuildingType == 0x300);
+	CHECK(trace.buildingChecks[0].existingBuildingStyles.size() == 1);
+	CHECK(!trace.buildingChecks[0].result);
+}
+
+TEST_CASE(TraceReplayer_LotChecksMatchRecordedResults)
+{
+	const TraceBuilder builder = TraceBuilder()
+		.Context(1, 0, 0, false, { Chicago1890 }, { Chicago1890, NewYork1940 })
+		.LotConfiguration(0x100, { 0x1000, Chicago1890, kBuildingStylesProperty })
+		.LotConfiguration(0x101, { 0x1000, NewYork1940, kBuildingStylesProperty })
+		.LotConfiguration(0x102, { 0x1000 })
+		.LotCheck(0x100, PurposeResidence, true)
+		.LotCheck(0x101, PurposeResidence, false)
+		// Industrial lots without the Building Styles property are compatible with all styles.
+		.LotCheck(0x102, PurposeManufacturing, true);
+
+	const TraceReplayer::ReplayResult result = ReplayTrace(builder);
+
+	CHECK(result.lotChecks == 3);
+	CHECK(result.missingProperties == 0);
+	CHECK(result.divergences.empty());
+}
+
+TEST_CASE(TraceReplayer_BuildingChecksMatchRecordedResults)
+{
+	const TraceBuilder builder = TraceBuilder()
+		.Context(1, 0, LotZoningOptionDisableAggregation, true, { Chicago1890, NewYork1940 }, { Chicago1890, NewYork1940 })
+		.Building(0x200, BuildingStyleRecord::FlagHasBuildingStylesProperty, { Chicago1890 })
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotSameSize, 0, {}, true)
+		// The user disabled lot aggregation.
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotAggregation, 0, {}, false)
+		// The existing building does not share a style with the new building.
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotSameSize, 0x300, { NewYork1940 }, false)
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotSameSize, 0x301, { Chicago1890 }, true);
+
+	const TraceReplayer::ReplayResult result = ReplayTrace(builder);
+
+	CHECK(result.buildingChecks == 4);
+	CHECK(result.divergences.empty());
+}
+
+TEST_CASE(TraceReplayer_ReportsDivergences)
+{
+	const TraceBuilder builder = TraceBuilder()
+		.Context(1, 0, 0, false, { Chicago1890 }, { Chicago1890 })
+		.LotConfiguration(0x100, { 0x1000, NewYork1940, kBuildingStylesProperty })
+		.LotCheck(0x100, PurposeResidence, true)
+		.Building(0x200, BuildingStyleRecord::FlagHasBuildingStylesProperty, { Chicago1890 })
+		.BuildingCheck(0x200, PurposeResidence, DevelopmentTypeLotSameSize, 0, {}, false);
+
+	const TraceReplayer::ReplayResult result = ReplayTrace(builder);
+
+	CHECK(result.divergences.size() == 2);
+	CHECK(result.divergences[0].type == TraceReplayer::CheckType::Lot);
+	CHECK(result.divergences[0].id == 0x100);
+	CHECK(result.divergences[0].recordedResult);
+	CHECK(!result.divergences[0].replayedResult);
+	CHECK(result.divergences[1].type == TraceReplayer::CheckType::Building);
+	CHECK(result.divergences[1].replayedResult);
+}
+
+TEST_CASE(TraceReplayer_CountsMissingProperties)
+{
+	const TraceBuilder builder = TraceBuilder()
+		.Context(1, 0, 0, false, { Chicago1890 }, { Chicago1890 })
+		.LotCheck(0x100, PurposeResidence, true);
+
+	const TraceReplayer::ReplayResult result = ReplayTrace(builder);
+
+	CHECK(result.missingProperties == 1);
+	CHECK(result.divergences.empty());
+}
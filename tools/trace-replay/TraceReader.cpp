@@ -0,0 +1,201 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TraceReader.h"
+#include "StyleSelectionTraceFormat.h"
+#include <type_traits>
+
+using RecordType = StyleSelectionTraceFormat::RecordType;
+
+namespace
+{
+	class RecordReader
+	{
+	public:
+		explicit RecordReader(std::istream& stream)
+			: stream(stream)
+		{
+		}
+
+		template<typename T> bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+		}
+
+		bool Read(bool& value)
+		{
+			uint8_t byte = 0;
+
+			if (!Read(byte))
+			{
+				return false;
+			}
+
+			value = byte != 0;
+			return true;
+		}
+
+		bool Read(std::vector<uint32_t>& values)
+		{
+			uint32_t count = 0;
+
+			if (!Read(count))
+			{
+				return false;
+			}
+
+			values.resize(count);
+			return static_cast<bool>(stream.read(
+				reinterpret_cast<char*>(values.data()),
+				static_cast<std::streamsize>(count * sizeof(uint32_t))));
+		}
+
+		// Gets a value indicating if the stream is at the end of the file.
+		bool AtEnd()
+		{
+			return stream.peek() == std::istream::traits_type::eof();
+		}
+
+	private:
+		std::istream& stream;
+	};
+
+	bool ReadContext(RecordReader& reader, TraceContext& context)
+	{
+		return reader.Read(context.epoch)
+			&& reader.Read(context.wallToWallOption)
+			&& reader.Read(context.lotZoningOptions)
+			&& reader.Read(context.preventCrossStyleRedevelopment)
+			&& reader.Read(context.changeStylesEveryNYears)
+			&& reader.Read(context.currentStyleIndex)
+			&& reader.Read(context.activeStyles)
+			&& reader.Read(context.availableStyles);
+	}
+
+	bool ReadBuildingCheck(RecordReader& reader, TraceBuildingCheck& check)
+	{
+		return reader.Read(check.buildingType)
+			&& reader.Read(check.purpose)
+			&& reader.Read(check.developmentType)
+			&& reader.Read(check.lotLocationX)
+			&& reader.Read(check.lotLocationZ)
+			&& reader.Read(check.lotSizeX)
+			&& reader.Read(check.lotSizeZ)
+			&& reader.Read(check.facing)
+			&& reader.Read(check.existingBuildingType)
+			&& reader.Read(check.existingBuildingStyles)
+			&& reader.Read(check.result);
+	}
+}
+
+bool TraceReader::Read(std::istream& stream, Trace& trace, std::string& errorMessage)
+{
+	RecordReader reader(stream);
+
+	uint32_t signature = 0;
+	uint32_t version = 0;
+
+	if (!reader.Read(signature) || signature != StyleSelectionTraceFormat::Signature)
+	{
+		errorMessage = "The file is not a style selection trace.";
+		return false;
+	}
+
+	if (!reader.Read(version) || version != StyleSelectionTraceFormat::Version)
+	{
+		errorMessage = "Unsupported trace version " + std::to_string(version)
+			+ ", expected version " + std::to_string(StyleSelectionTraceFormat::Version) + ".";
+		return false;
+	}
+
+	trace = Trace();
+
+	while (!reader.AtEnd())
+	{
+		const std::streamoff recordOffset = stream.tellg();
+		RecordType type{};
+		bool recordValid = false;
+
+		if (!reader.Read(type))
+		{
+			break;
+		}
+
+		switch (type)
+		{
+		case RecordType::Context:
+		{
+			TraceContext context;
+			recordValid = ReadContext(reader, context);
+			trace.contexts.push_back(std::move(context));
+			break;
+		}
+		case RecordType::BuildingProperties:
+		{
+			uint32_t buildingType = 0;
+			TraceBuildingProperties properties;
+			recordValid = reader.Read(buildingType)
+				&& reader.Read(properties.flags)
+				&& reader.Read(properties.styles);
+			trace.buildings.insert_or_assign(buildingType, std::move(properties));
+			break;
+		}
+		case RecordType::LotConfigurationProperties:
+		{
+			uint32_t lotConfigurationID = 0;
+			std::vector<uint32_t> occupantGroups;
+			recordValid = reader.Read(lotConfigurationID) && reader.Read(occupantGroups);
+			trace.lotConfigurations.insert_or_assign(lotConfigurationID, std::move(occupantGroups));
+			break;
+		}
+		case RecordType::LotCheck:
+		{
+			TraceLotCheck check;
+			check.contextIndex = trace.contexts.size() - 1;
+			recordValid = !trace.contexts.empty()
+				&& reader.Read(check.lotConfigurationID)
+				&& reader.Read(check.purpose)
+				&& reader.Read(check.result);
+			trace.lotChecks.push_back(check);
+			break;
+		}
+		case RecordType::BuildingCheck:
+		{
+			TraceBuildingCheck check;
+			check.contextIndex = trace.contexts.size() - 1;
+			recordValid = !trace.contexts.empty() && ReadBuildingCheck(reader, check);
+			trace.buildingChecks.push_back(std::move(check));
+			break;
+		}
+		}
+
+		if (!recordValid)
+		{
+			errorMessage = "Invalid or truncated record of type " + std::to_string(static_cast<uint32_t>(type))
+				+ " at offset " + std::to_string(static_cast<int64_t>(recordOffset)) + ".";
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// The contents of a style selection trace, see StyleSelectionTrace.h in the plugin
+// source for the file format.
+struct TraceContext
+{
+	uint32_t epoch = 0;
+	uint8_t wallToWallOption = 0;
+	uint8_t lotZoningOptions = 0;
+	bool preventCrossStyleRedevelopment = false;
+	uint8_t changeStylesEveryNYears = 0;
+	uint32_t currentStyleIndex = 0;
+	std::vector<uint32_t> activeStyles;
+	std::vector<uint32_t> availableStyles;
+};
+
+struct TraceBuildingProperties
+{
+	uint8_t flags = 0;
+	std::vector<uint32_t> styles;
+};
+
+struct TraceLotCheck
+{
+	size_t contextIndex = 0;
+	uint32_t lotConfigurationID = 0;
+	uint32_t purpose = 0;
+	bool result = false;
+};
+
+struct TraceBuildingCheck
+{
+	size_t contextIndex = 0;
+	uint32_t buildingType = 0;
+	uint32_t purpose = 0;
+	uint8_t developmentType = 0;
+	uint32_t lotLocationX = 0;
+	uint32_t lotLocationZ = 0;
+	uint8_t lotSizeX = 0;
+	uint8_t lotSizeZ = 0;
+	uint8_t facing = 0;
+	uint32_t existingBuildingType = 0;
+	std::vector<uint32_t> existingBuildingStyles;
+	bool result = false;
+};
+
+struct Trace
+{
+	std::vector<TraceContext> contexts;
+	std::unordered_map<uint32_t, TraceBuildingProperties> buildings;
+	std::unordered_map<uint32_t, std::vector<uint32_t>> lotConfigurations;
+	std::vector<TraceLotCheck> lotChecks;
+	std::vector<TraceBuildingCheck> buildingChecks;
+};
+
+namespace TraceReader
+{
+	// Reads a trace from the stream.
+	// Returns false and sets the error message if the stream is not a valid trace.
+	bool Read(std::istream& stream, Trace& trace, std::string& errorMessage);
+}
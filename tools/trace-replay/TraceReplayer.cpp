@@ -0,0 +1,205 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TraceReplayer.h"
+#include "BuildingStyleCatalog.h"
+#include "PropertyIDs.h"
+#include "StyleCompatibilityEngine.h"
+#include "StyleListSearch.h"
+#include <span>
+
+using WallToWallOption = IBuildingSelectWinContext::WallToWallOption;
+
+namespace
+{
+	// The game's cISC4BuildingOccupant::PurposeType values.
+	constexpr uint32_t PurposeResidence = 1;
+	constexpr uint32_t PurposeOffice = 3;
+	constexpr uint32_t PurposeAgriculture = 5;
+	constexpr uint32_t PurposeHighTech = 8;
+
+	// The game's candidate lot development types.
+	constexpr uint8_t DevelopmentTypeLotAggregation = 3;
+	constexpr uint8_t DevelopmentTypeLotSubdivision = 4;
+
+	bool IsIndustrialPurpose(uint32_t purpose)
+	{
+		return purpose >= PurposeAgriculture && purpose <= PurposeHighTech;
+	}
+
+	// Only the current style is used when the game is set to change styles every N years.
+	std::span<const uint32_t> GetStylesInUse(const TraceContext& context)
+	{
+		std::span<const uint32_t> styles(context.activeStyles);
+
+		if (context.changeStylesEveryNYears != 0 && context.currentStyleIndex < styles.size())
+		{
+			styles = styles.subspan(context.currentStyleIndex, 1);
+		}
+
+		return styles;
+	}
+
+	// Lot aggregation and subdivision can only be disabled for the residential and commercial purpose types.
+	bool CandidateLotMatchesZoningOptions(const TraceContext& context, const TraceBuildingCheck& check)
+	{
+		const uint8_t lotZoningOptions = check.purpose >= PurposeResidence && check.purpose <= PurposeOffice
+			? context.lotZoningOptions
+			: static_cast<uint8_t>(LotZoningOptionNone);
+
+		switch (check.developmentType)
+		{
+		case DevelopmentTypeLotAggregation:
+			return (lotZoningOptions & LotZoningOptionDisableAggregation) == 0;
+		case DevelopmentTypeLotSubdivision:
+			return (lotZoningOptions & LotZoningOptionDisableSubdivision) == 0;
+		default:
+			return true;
+		}
+	}
+}
+
+bool TraceReplayer::ReplayLotCheck(const Trace& trace, const TraceLotCheck& check, bool& missingProperties)
+{
+	const TraceContext& context = trace.contexts[check.contextIndex];
+	const auto lotConfiguration = trace.lotConfigurations.find(check.lotConfigurationID);
+
+	missingProperties = lotConfiguration == trace.lotConfigurations.end();
+
+	if (missingProperties)
+	{
+		return false;
+	}
+
+	const std::span<const uint32_t> occupantGroups(lotConfiguration->second);
+
+	if (!StyleCompatibilityEngine::CheckWallToWallOption(
+		static_cast<WallToWallOption>(context.wallToWallOption),
+		StyleCompatibilityEngine::HasWallToWallOccupantGroup(occupantGroups)))
+	{
+		return false;
+	}
+
+	if (StyleCompatibilityEngine::IsCompatibleWithAllStyles(
+		StyleCompatibilityEngine::ContainsStyle(occupantGroups, kBuildingStylesProperty),
+		IsIndustrialPurpose(check.purpose)))
+	{
+		return true;
+	}
+
+	return StyleListSearch::FindFirstCommonValue(GetStylesInUse(context), occupantGroups).has_value();
+}
+
+bool TraceReplayer::ReplayBuildingCheck(const Trace& trace, const TraceBuildingCheck& check, bool& missingProperties)
+{
+	const TraceContext& context = trace.contexts[check.contextIndex];
+	const auto building = trace.buildings.find(check.buildingType);
+
+	missingProperties = building == trace.buildings.end();
+
+	if (missingProperties || !CandidateLotMatchesZoningOptions(context, check))
+	{
+		return false;
+	}
+
+	const TraceBuildingProperties& properties = building->second;
+
+	if (!StyleCompatibilityEngine::CheckWallToWallOption(
+		static_cast<WallToWallOption>(context.wallToWallOption),
+		(properties.flags & BuildingStyleRecord::FlagWallToWall) != 0))
+	{
+		return false;
+	}
+
+	if (properties.styles.empty())
+	{
+		return false;
+	}
+
+	bool result = StyleCompatibilityEngine::IsCompatibleWithAllStyles(
+		(properties.flags & BuildingStyleRecord::FlagHasBuildingStylesProperty) != 0,
+		IsIndustrialPurpose(check.purpose));
+
+	if (!result)
+	{
+		result = StyleListSearch::FindFirstCommonValue(GetStylesInUse(context), properties.styles).has_value();
+	}
+
+	if (result && context.preventCrossStyleRedevelopment && check.existingBuildingType != 0)
+	{
+		const std::optional<bool> stylesMatch = StyleCompatibilityEngine::StylesMatch(
+			properties.styles,
+			check.existingBuildingStyles,
+			[&](uint32_t style) { return StyleCompatibilityEngine::ContainsStyle(context.availableStyles, style); });
+
+		if (stylesMatch.has_value())
+		{
+			result = stylesMatch.value();
+		}
+	}
+
+	return result;
+}
+
+TraceReplayer::ReplayResult TraceReplayer::Replay(const Trace& trace)
+{
+	ReplayResult replayResult;
+
+	for (size_t i = 0; i < trace.lotChecks.size(); i++)
+	{
+		const TraceLotCheck& check = trace.lotChecks[i];
+		bool missingProperties = false;
+
+		const bool result = ReplayLotCheck(trace, check, missingProperties);
+
+		replayResult.lotChecks++;
+
+		if (missingProperties)
+		{
+			replayResult.missingProperties++;
+		}
+		else if (result != check.result)
+		{
+			replayResult.divergences.push_back(Divergence{ CheckType::Lot, i, check.lotConfigurationID, check.result, result });
+		}
+	}
+
+	for (size_t i = 0; i < trace.buildingChecks.size(); i++)
+	{
+		const TraceBuildingCheck& check = trace.buildingChecks[i];
+		bool missingProperties = false;
+
+		const bool result = ReplayBuildingCheck(trace, check, missingProperties);
+
+		replayResult.buildingChecks++;
+
+		if (missingProperties)
+		{
+			replayResult.missingProperties++;
+		}
+		else if (result != check.result)
+		{
+			replayResult.divergences.push_back(Divergence{ CheckType::Building, i, check.buildingType, check.result, result });
+		}
+	}
+
+	return replayResult;
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "TraceReader.h"
+#include <cstdint>
+#include <vector>
+
+// Re-runs the growth style decisions that are recorded in a trace and compares
+// them with the verdicts that the plugin returned in the game.
+namespace TraceReplayer
+{
+	enum class CheckType
+	{
+		Lot,
+		Building
+	};
+
+	struct Divergence
+	{
+		CheckType type;
+		// The index of the check in the trace's lot or building check list.
+		size_t checkIndex;
+		// The lot configuration id or building type.
+		uint32_t id;
+		bool recordedResult;
+		bool replayedResult;
+	};
+
+	struct ReplayResult
+	{
+		uint64_t lotChecks = 0;
+		uint64_t buildingChecks = 0;
+		// The lot and building checks that reference properties which are not in the trace.
+		uint64_t missingProperties = 0;
+		std::vector<Divergence> divergences;
+	};
+
+	bool ReplayLotCheck(const Trace& trace, const TraceLotCheck& check, bool& missingProperties);
+	bool ReplayBuildingCheck(const Trace& trace, const TraceBuildingCheck& check, bool& missingProperties);
+
+	ReplayResult Replay(const Trace& trace);
+}
@@ -0,0 +1,161 @@
+/*
+ * This file is part of sc4-more-building-styles, a DLL Plugin for
+ * SimCity 4 that adds support for more building styles.
+ *
+ * Copyright (C) 2024, 2025, 2026 Nicholas Hayes
+ *
+ * sc4-more-building-styles is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * sc4-more-building-styles is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sc4-more-building-styles.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TraceReader.h"
+#include "TraceReplayer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+// Replays a style selection trace that was written by the plugin's StyleSelectionTrace
+// debug option, and reports the replay throughput and any decisions that differ from
+// the ones the plugin made in the game.
+//
+// Usage: trace-replay <trace file> [--repeat N] [--max-divergences N]
+// The exit code is 0 if all decisions match, 1 if any differ and 2 for usage or file errors.
+
+namespace
+{
+	void PrintUsage()
+	{
+		std::fprintf(stderr, "Usage: trace-replay <trace file> [--repeat N] [--max-divergences N]\n");
+	}
+
+	const char* GetCheckTypeName(TraceReplayer::CheckType type)
+	{
+		return type == TraceReplayer::CheckType::Lot ? "lot configuration" : "building";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* tracePath = nullptr;
+	uint64_t repeatCount = 10;
+	size_t maxDivergences = 20;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string_view argument(argv[i]);
+
+		if (argument == "--repeat" && i + 1 < argc)
+		{
+			repeatCount = std::max<uint64_t>(1, std::strtoull(argv[++i], nullptr, 10));
+		}
+		else if (argument == "--max-divergences" && i + 1 < argc)
+		{
+			maxDivergences = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (!tracePath && !argument.starts_with("--"))
+		{
+			tracePath = argv[i];
+		}
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+
+	if (!tracePath)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	std::ifstream stream(tracePath, std::ifstream::in | std::ifstream::binary);
+
+	if (!stream)
+	{
+		std::fprintf(stderr, "Failed to open %s.\n", tracePath);
+		return 2;
+	}
+
+	Trace trace;
+	std::string errorMessage;
+
+	if (!TraceReader::Read(stream, trace, errorMessage))
+	{
+		std::fprintf(stderr, "%s: %s\n", tracePath, errorMessage.c_str());
+		return 2;
+	}
+
+	std::printf(
+		"%zu contexts, %zu buildings, %zu lot configurations, %zu lot checks, %zu building checks\n",
+		trace.contexts.size(),
+		trace.buildings.size(),
+		trace.lotConfigurations.size(),
+		trace.lotChecks.size(),
+		trace.buildingChecks.size());
+
+	TraceReplayer::ReplayResult result;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint64_t i = 0; i < repeatCount; i++)
+	{
+		result = TraceReplayer::Replay(trace);
+	}
+
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const uint64_t checkCount = result.lotChecks + result.buildingChecks;
+
+	if (checkCount > 0 && elapsed.count() > 0)
+	{
+		const double totalChecks = static_cast<double>(checkCount * repeatCount);
+
+		std::printf(
+			"Replayed %llu checks %llu times: %.0f checks/s, %.1f ns/check\n",
+			static_cast<unsigned long long>(checkCount),
+			static_cast<unsigned long long>(repeatCount),
+			totalChecks / elapsed.count(),
+			elapsed.count() * 1e9 / totalChecks);
+	}
+
+	if (result.missingProperties > 0)
+	{
+		std::printf(
+			"%llu checks skipped, their lot configuration or building properties are not in the trace.\n",
+			static_cast<unsigned long long>(result.missingProperties));
+	}
+
+	const size_t printedDivergences = std::min(result.divergences.size(), maxDivergences);
+
+	for (size_t i = 0; i < printedDivergences; i++)
+	{
+		const TraceReplayer::Divergence& divergence = result.divergences[i];
+
+		std::printf(
+			"Divergence: %s check %zu, 0x%08X: recorded %s, replayed %s\n",
+			GetCheckTypeName(divergence.type),
+			divergence.checkIndex,
+			divergence.id,
+			divergence.recordedResult ? "true" : "false",
+			divergence.replayedResult ? "true" : "false");
+	}
+
+	std::printf("%zu divergences\n", result.divergences.size());
+
+	return result.divergences.empty() ? 0 : 1;
+}